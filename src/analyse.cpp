@@ -0,0 +1,487 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2014 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "engine.h"
+#include "evaluate.h"
+#include "misc.h"
+#include "notation.h"
+#include "ucioption.h"
+
+using namespace std;
+
+namespace {
+
+  // The input file and the output format, shared by all the workers
+  struct Batch {
+    Mutex mutex;
+    ifstream file;
+    uint64_t read;
+    bool packed, json;
+    Search::LimitsType limits;
+  };
+
+  // A worker analyses positions one at a time with its own engine, that has a
+  // single search thread and a slice of the hash.
+  struct Worker {
+    Engine engine;
+    NativeHandle handle;
+    Batch* batch;
+    int depth;
+    uint64_t positions, nodes;
+  };
+
+
+  // fen_fields() extracts the FEN from a line in FEN or EPD format: anything
+  // after the first four fields is dropped unless it is the halfmove clock and
+  // the fullmove number.
+
+  string fen_fields(const string& line) {
+
+    istringstream is(line);
+    string token, fen;
+
+    for (int i = 0; i < 6 && is >> token; ++i)
+    {
+        if (i >= 4 && token.find_first_not_of("0123456789") != string::npos)
+            break;
+
+        fen += (i ? " " : "") + token;
+    }
+
+    return fen;
+  }
+
+
+  // next_position() reads the next FEN string or packed position from the
+  // input, skipping blank lines. Returns false at the end of the input.
+
+  bool next_position(istream& is, bool packed, string& line, PackedPosition& pp) {
+
+    if (packed)
+        return !!is.read((char*)&pp, sizeof(PackedPosition));
+
+    while (getline(is, line))
+        if (line.find_first_not_of(" \t\r") != string::npos)
+            return true;
+
+    return false;
+  }
+
+
+  // next_fen() reads the next position from the input file as a FEN string
+
+  bool next_fen(Batch& b, string& fen, uint64_t& index) {
+
+    string line;
+    PackedPosition pp;
+
+    b.mutex.lock();
+
+    bool ok = next_position(b.file, b.packed, line, pp);
+    index = b.read++;
+
+    b.mutex.unlock();
+
+    if (!ok)
+        return false;
+
+    if (b.packed)
+    {
+        Position pos;
+        pos.set(pp, Options["UCI_Chess960"], NULL);
+        fen = pos.fen();
+    }
+    else
+        fen = fen_fields(line);
+
+    return true;
+  }
+
+
+  // on_pv() records the depth of the last completed iteration. Nothing is
+  // printed until the position is finished.
+
+  void on_pv(const Engine& e, int depth, Value, Value) {
+
+    Worker* w = (Worker*)e.userData;
+
+    if (e.rootMoves[0].score != -VALUE_INFINITE)
+        w->depth = depth;
+  }
+
+
+  // result() formats the analysis of a position as a CSV or JSON line
+
+  string result(const Worker& w, uint64_t index, const string& fen) {
+
+    const Engine& e = w.engine;
+    const Search::RootMove& rm = e.rootMoves[0];
+    bool mate = abs(rm.score) >= VALUE_MATE_IN_MAX_PLY;
+    int score =  mate ? (rm.score > 0 ? VALUE_MATE - rm.score + 1 : -VALUE_MATE - rm.score) / 2
+                      : rm.score * 100 / PawnValueEg;
+    string move = move_to_uci(rm.pv[0], e.rootPos.is_chess960());
+    stringstream ss;
+
+    if (rm.pv[0] == MOVE_NONE) // Mate or stalemate
+        score = 0, mate = false;
+
+    if (w.batch->json)
+        ss << "{\"index\":" << index << ",\"fen\":\"" << fen
+           << "\",\"bestmove\":\"" << move << "\",\"" << (mate ? "mate" : "cp")
+           << "\":" << score << ",\"depth\":" << w.depth
+           << ",\"nodes\":" << e.rootPos.nodes_searched() << "}";
+    else
+        ss << index << "," << fen << "," << move << "," << (mate ? "mate" : "cp")
+           << "," << score << "," << w.depth << "," << e.rootPos.nodes_searched();
+
+    return ss.str();
+  }
+
+
+  // analyse_positions() is the loop of the worker threads
+
+  extern "C" long analyse_positions(Worker* w) {
+
+    Search::StateStackPtr st;
+    string fen;
+    uint64_t index;
+
+    while (next_fen(*w->batch, fen, index))
+    {
+        Position pos(fen, Options["UCI_Chess960"], w->engine.threads.main());
+
+        w->depth = 0;
+        w->engine.threads.start_thinking(pos, w->batch->limits, st);
+        w->engine.threads.wait_for_think_finished();
+
+        ++w->positions;
+        w->nodes += w->engine.rootPos.nodes_searched();
+
+        sync_cout << result(*w, index, fen) << sync_endl;
+    }
+
+    return 0;
+  }
+
+
+  // Positions are read and evaluated in chunks of lines, so that the workers
+  // rarely contend for the input and the output.
+  const size_t ChunkSize = 4096;
+
+  // The input stream and the chunks evaluated but not yet written, shared by
+  // all the eval workers. Chunks are written in input order by the worker that
+  // completes the next expected one.
+  struct EvalBatch {
+    Mutex inputMutex, outputMutex;
+    istream* input;
+    bool packed;
+    uint64_t chunksRead, chunksWritten;
+    map<uint64_t, string> done;
+  };
+
+  struct EvalWorker {
+    Engine engine; // Its main thread holds the pawn and material hash tables
+    NativeHandle handle;
+    EvalBatch* batch;
+    uint64_t positions;
+  };
+
+
+  // evaluate_positions() is the loop of the eval worker threads
+
+  extern "C" long evaluate_positions(EvalWorker* w) {
+
+    EvalBatch& b = *w->batch;
+    Thread* th = w->engine.threads.main();
+    bool chess960 = Options["UCI_Chess960"];
+    vector<string> lines(ChunkSize);
+    vector<PackedPosition> packed(ChunkSize);
+    Position pos;
+    string out;
+    char buf[16];
+
+    while (true)
+    {
+        size_t cnt = 0;
+
+        b.inputMutex.lock();
+
+        uint64_t chunk = b.chunksRead++;
+
+        while (cnt < ChunkSize && next_position(*b.input, b.packed, lines[cnt], packed[cnt]))
+            ++cnt;
+
+        b.inputMutex.unlock();
+
+        if (!cnt)
+            break;
+
+        out.clear();
+
+        for (size_t i = 0; i < cnt; ++i)
+        {
+            if (b.packed)
+                pos.set(packed[i], chess960, th);
+            else
+                pos.set(fen_fields(lines[i]), chess960, th);
+
+            if (pos.checkers()) // Evaluation is not defined when in check
+                out += "none\n";
+            else
+            {
+                sprintf(buf, "%d\n", Eval::evaluate(pos) * 100 / PawnValueEg);
+                out += buf;
+            }
+        }
+
+        w->positions += cnt;
+
+        b.outputMutex.lock();
+
+        b.done[chunk].swap(out);
+
+        map<uint64_t, string>::iterator it;
+
+        while ((it = b.done.find(b.chunksWritten)) != b.done.end())
+        {
+            cout << it->second << flush;
+            b.done.erase(it);
+            ++b.chunksWritten;
+        }
+
+        b.outputMutex.unlock();
+    }
+
+    return 0;
+  }
+
+} // namespace
+
+
+/// analyse() annotates the positions of a file, one FEN or EPD per line or
+/// packed positions if the file name ends with ".bin", with best move, score,
+/// depth and nodes searched. Positions are distributed among the given number
+/// of workers, each one with its own search thread and an equal slice of the
+/// hash, so that the throughput scales with the number of cores. The
+/// parameters are the file name, the number of workers (default is the
+/// "Threads" option), the limit value and type ('depth', 'nodes' or 'movetime'
+/// in msec, default is depth 10) and the output format ('csv' or 'json').
+/// Results are written as soon as a position is done, so they are not in input
+/// order: each line starts with the position index in the file.
+
+void analyse(istream& is) {
+
+  string fileName, token;
+  Batch batch;
+
+  is >> fileName;
+  int workers      = (is >> token) ? atoi(token.c_str()) : int(Options["Threads"]);
+  int limit        = (is >> token) ? atoi(token.c_str()) : 10;
+  string limitType = (is >> token) ? token : "depth";
+  batch.json       = (is >> token) && token == "json";
+  batch.read       = 0;
+
+  if (limitType == "nodes")
+      batch.limits.nodes = limit;
+
+  else if (limitType == "movetime")
+      batch.limits.movetime = limit;
+
+  else
+      batch.limits.depth = limit;
+
+  batch.packed = is_packed_file(fileName);
+  batch.file.open(fileName.c_str(), ios::binary);
+
+  if (!batch.file.is_open())
+  {
+      cerr << "Unable to open file " << fileName << endl;
+      return;
+  }
+
+  workers = std::min(std::max(workers, 1), MAX_THREADS);
+  size_t hashSlice = std::max(int(Options["Hash"]) / workers, 1);
+  vector<Worker*> pool;
+  Time::point elapsed = Time::now();
+
+  if (!batch.json)
+      sync_cout << "index,fen,bestmove,score_type,score,depth,nodes" << sync_endl;
+
+  for (int i = 0; i < workers; ++i)
+  {
+      Worker* w = new Worker;
+
+      w->engine.init(1, hashSlice);
+      w->engine.onPv = on_pv;
+      w->engine.userData = w;
+      w->batch = &batch;
+      w->positions = w->nodes = 0;
+
+      thread_create(w->handle, analyse_positions, w);
+      pool.push_back(w);
+  }
+
+  uint64_t positions = 0, nodes = 0;
+
+  for (size_t i = 0; i < pool.size(); ++i)
+  {
+      thread_join(pool[i]->handle);
+
+      positions += pool[i]->positions;
+      nodes += pool[i]->nodes;
+
+      pool[i]->engine.exit();
+      delete pool[i];
+  }
+
+  elapsed = std::max(Time::now() - elapsed, Time::point(1));
+
+  cerr << "\n==========================="
+       << "\nWorkers         : " << workers
+       << "\nPositions       : " << positions
+       << "\nTotal time (ms) : " << elapsed
+       << "\nPositions/second: " << 1000 * positions / elapsed
+       << "\nNodes searched  : " << nodes
+       << "\nNodes/second    : " << 1000 * nodes / elapsed << endl;
+}
+
+
+/// eval_batch() prints the static evaluation of the positions of a file, one
+/// FEN or EPD per line, or of the standard input if the file name is '-'. The
+/// input holds packed positions if the file name ends with ".bin" or if the
+/// optional 'packed' parameter follows the number of workers. The scores are
+/// in centipawns from the side to move point of view, one per line and in input
+/// order, or 'none' when the side to move is in check. Workers (default is the
+/// "Threads" option) evaluate chunks of positions in parallel, each with its
+/// own engine, so its own pawn and material hash tables.
+
+void eval_batch(istream& is) {
+
+  string fileName, token;
+  ifstream file;
+  EvalBatch batch;
+
+  is >> fileName;
+  int workers = (is >> token) ? atoi(token.c_str()) : int(Options["Threads"]);
+
+  if (fileName != "-")
+  {
+      file.open(fileName.c_str(), ios::binary);
+
+      if (!file.is_open())
+      {
+          cerr << "Unable to open file " << fileName << endl;
+          return;
+      }
+  }
+
+  batch.input = fileName == "-" ? &cin : &file;
+  batch.packed = is_packed_file(fileName) || (is >> token && token == "packed");
+  batch.chunksRead = batch.chunksWritten = 0;
+
+  workers = std::min(std::max(workers, 1), MAX_THREADS);
+  vector<EvalWorker*> pool;
+  Time::point elapsed = Time::now();
+
+  for (int i = 0; i < workers; ++i)
+  {
+      EvalWorker* w = new EvalWorker;
+
+      w->engine.init(1, 0); // No search, so no hash
+      w->batch = &batch;
+      w->positions = 0;
+
+      thread_create(w->handle, evaluate_positions, w);
+      pool.push_back(w);
+  }
+
+  uint64_t positions = 0;
+
+  for (size_t i = 0; i < pool.size(); ++i)
+  {
+      thread_join(pool[i]->handle);
+
+      positions += pool[i]->positions;
+
+      pool[i]->engine.exit();
+      delete pool[i];
+  }
+
+  elapsed = std::max(Time::now() - elapsed, Time::point(1));
+
+  cerr << "\n==========================="
+       << "\nWorkers         : " << workers
+       << "\nPositions       : " << positions
+       << "\nTotal time (ms) : " << elapsed
+       << "\nPositions/second: " << 1000 * positions / elapsed << endl;
+}
+
+
+/// convert() converts a file of positions from FEN or EPD format to packed
+/// positions, or the other way around, according to the file extensions.
+
+void convert(istream& is) {
+
+  string inName, outName, line;
+
+  is >> inName >> outName;
+
+  ifstream input(inName.c_str(), ios::binary);
+  ofstream output(outName.c_str(), ios::binary);
+
+  if (!input.is_open() || !output.is_open())
+  {
+      cerr << "Unable to open files " << inName << " and " << outName << endl;
+      return;
+  }
+
+  bool chess960 = Options["UCI_Chess960"];
+  bool packedIn = is_packed_file(inName), packedOut = is_packed_file(outName);
+  PackedPosition pp;
+  Position pos;
+  uint64_t cnt = 0;
+
+  for ( ; next_position(input, packedIn, line, pp); ++cnt)
+  {
+      if (packedIn)
+          pos.set(pp, chess960, NULL);
+      else
+          pos.set(fen_fields(line), chess960, NULL);
+
+      if (packedOut)
+      {
+          pp = pos.packed();
+          output.write((const char*)&pp, sizeof(PackedPosition));
+      }
+      else
+          output << pos.fen() << "\n";
+  }
+
+  cerr << "Converted " << cnt << " positions" << endl;
+}
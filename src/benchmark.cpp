@@ -19,16 +19,17 @@
 
 #include <algorithm>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
 #include <istream>
+#include <sstream>
 #include <vector>
 
+#include "engine.h"
 #include "misc.h"
 #include "notation.h"
 #include "position.h"
 #include "search.h"
-#include "thread.h"
-#include "tt.h"
 #include "ucioption.h"
 
 using namespace std;
@@ -67,13 +68,140 @@ static const char* Defaults[] = {
 };
 
 
+// A position where the best move at depth 12 with MultiPV 2 is generated after
+// the first two root moves and is found only after a fail high at root, when a
+// shared window search must still search the moves left out by the cutoff.
+static const char* MultiPVCheck = "r1bq1rk1/ppp1nppp/4n3/3p3Q/3P4/1BP1B3/PP1N2PP/R4RK1 w - - 1 16";
+
+
+/// multipv_benchmark() compares the time to reach the given depth with MultiPV
+/// from 1 to 10, for both the MultiPV loop and the shared window search. First
+/// it checks that the two agree on the best move of the MultiPVCheck position.
+
+static void multipv_benchmark(const vector<string>& fens, const Search::LimitsType& limits) {
+
+  Search::StateStackPtr st;
+  std::ostringstream multiPV;
+  string sharedWindow = Options["MultiPV Shared Window"] ? "true" : "false";
+  Time::point elapsed[2][11];
+  uint64_t nodes[2][11];
+
+  multiPV << int(Options["MultiPV"]);
+
+  Search::LimitsType checkLimits;
+  Move best[2];
+
+  checkLimits.depth = 12;
+  Options["MultiPV"] = string("2");
+
+  for (int shared = 1; shared >= 0; --shared) // Shared first, with empty caches
+  {
+      Options["MultiPV Shared Window"] = string(shared ? "true" : "false");
+      UCIEngine.tt.clear();
+
+      Position pos(MultiPVCheck, false, UCIEngine.threads.main());
+
+      UCIEngine.threads.start_thinking(pos, checkLimits, st);
+      UCIEngine.threads.wait_for_think_finished();
+      best[shared] = UCIEngine.rootMoves[0].pv[0];
+  }
+
+  for (int shared = 0; shared < 2; ++shared)
+      for (int n = 1; n <= 10; ++n)
+      {
+          std::ostringstream ss;
+          ss << n;
+          Options["MultiPV"] = ss.str();
+          Options["MultiPV Shared Window"] = string(shared ? "true" : "false");
+          UCIEngine.tt.clear();
+
+          nodes[shared][n] = 0;
+          elapsed[shared][n] = Time::now();
+
+          for (size_t i = 0; i < fens.size(); ++i)
+          {
+              Position pos(fens[i], Options["UCI_Chess960"], UCIEngine.threads.main());
+
+              UCIEngine.threads.start_thinking(pos, limits, st);
+              UCIEngine.threads.wait_for_think_finished();
+              nodes[shared][n] += UCIEngine.rootPos.nodes_searched();
+          }
+
+          elapsed[shared][n] = std::max(Time::now() - elapsed[shared][n], Time::point(1));
+      }
+
+  Options["MultiPV"] = multiPV.str();
+  Options["MultiPV Shared Window"] = sharedWindow;
+
+  cerr << "\n===========================\nTime (ms) and nodes to depth " << limits.depth << endl;
+
+  for (int n = 1; n <= 10; ++n)
+      cerr << "MultiPV " << std::setw(2) << n
+           << "  loop: "   << std::setw(7) << elapsed[0][n] << " ms " << std::setw(11) << nodes[0][n]
+           << "  shared: " << std::setw(7) << elapsed[1][n] << " ms " << std::setw(11) << nodes[1][n]
+           << "  speedup: " << double(elapsed[0][n]) / elapsed[1][n] << endl;
+
+  cerr << "Best move check : loop " << move_to_uci(best[0], false)
+       << ", shared " << move_to_uci(best[1], false)
+       << (best[0] == best[1] ? " (ok)" : " (MISMATCH)") << endl;
+}
+
+
+/// attacks_benchmark() times attacks_bb<ROOK>() and attacks_bb<BISHOP>() with
+/// the occupancies of the given positions, 'millions' millions of lookups for
+/// each piece type. The square of each lookup depends on the result of the
+/// previous one, so that the time is the latency of a lookup.
+
+template<PieceType Pt>
+static double time_lookups(const vector<Bitboard>& occupancies, int millions, Bitboard& sum) {
+
+  Square s = SQ_A1;
+  Time::point elapsed = Time::now();
+
+  for (int n = 0; n < millions; ++n)
+      for (int i = 0; i < 1000000; )
+          for (size_t j = 0; j < occupancies.size() && i < 1000000; ++i, ++j)
+          {
+              sum += attacks_bb<Pt>(s, occupancies[j]);
+              s = Square((s + sum) & 63);
+          }
+
+  elapsed = std::max(Time::now() - elapsed, Time::point(1));
+
+  return double(elapsed) / millions; // Milliseconds per million is nanoseconds
+}
+
+static void attacks_benchmark(const vector<string>& fens, int millions) {
+
+  vector<Bitboard> occupancies;
+  Bitboard sum = 0;
+
+  for (size_t i = 0; i < fens.size(); ++i)
+      occupancies.push_back(Position(fens[i], false, NULL).pieces());
+
+  double rook = time_lookups<ROOK>(occupancies, millions, sum);
+  double bishop = time_lookups<BISHOP>(occupancies, millions, sum);
+
+  cerr << "\n==========================="
+       << "\nEntry (bytes)   : " << sizeof(SliderAttacks)
+       << "\nRook (ns)       : " << rook
+       << "\nBishop (ns)     : " << bishop
+       << "\nChecksum        : " << (sum & 0xFFFF) << endl;
+}
+
+
 /// benchmark() runs a simple benchmark by letting Stockfish analyze a set
 /// of positions for a given limit each. There are five parameters: the
 /// transposition table size, the number of search threads that should
 /// be used, the limit value spent for each position (optional, default is
 /// depth 13), an optional file name where to look for positions in FEN
-/// format (defaults are the positions defined above) and the type of the
-/// limit value: depth (default), time in secs or number of nodes.
+/// format, or packed if the name ends with ".bin" (defaults are the positions
+/// defined above) and the type of the limit value: depth (default), time in
+/// secs, number of nodes or clock time in secs. In the latter case the search
+/// is under time management, as in a game with the given time left on the
+/// clock, and a time usage report is printed.
+/// With 'multipv' the limit is a depth and the two MultiPV modes are compared.
+/// With 'attacks' the limit is the millions of slider attack lookups to time.
 
 void benchmark(const Position& current, istream& is) {
 
@@ -90,11 +218,21 @@ void benchmark(const Position& current, istream& is) {
 
   Options["Hash"]    = ttSize;
   Options["Threads"] = threads;
-  TT.clear();
+  UCIEngine.tt.clear();
+
+  for (size_t i = 0; i < UCIEngine.threads.size(); ++i)
+  {
+      UCIEngine.threads[i]->evalTable.probes = UCIEngine.threads[i]->evalTable.hits = 0;
+      UCIEngine.threads[i]->evalStats = Eval::Stats();
+      UCIEngine.threads[i]->nodeStats = Search::NodeStats();
+  }
 
   if (limitType == "time")
       limits.movetime = 1000 * atoi(limit.c_str()); // movetime is in ms
 
+  else if (limitType == "clock")
+      limits.time[WHITE] = limits.time[BLACK] = 1000 * atoi(limit.c_str());
+
   else if (limitType == "nodes")
       limits.nodes = atoi(limit.c_str());
 
@@ -113,7 +251,7 @@ void benchmark(const Position& current, istream& is) {
   else
   {
       string fen;
-      ifstream file(fenFile.c_str());
+      ifstream file(fenFile.c_str(), ios::binary);
 
       if (!file.is_open())
       {
@@ -121,20 +259,46 @@ void benchmark(const Position& current, istream& is) {
           return;
       }
 
-      while (getline(file, fen))
-          if (!fen.empty())
-              fens.push_back(fen);
+      if (is_packed_file(fenFile))
+      {
+          PackedPosition pp;
+          Position pos;
+
+          while (file.read((char*)&pp, sizeof(PackedPosition)))
+          {
+              pos.set(pp, Options["UCI_Chess960"], NULL);
+              fens.push_back(pos.fen());
+          }
+      }
+      else
+          while (getline(file, fen))
+              if (!fen.empty())
+                  fens.push_back(fen);
 
       file.close();
   }
 
+  if (limitType == "multipv")
+  {
+      multipv_benchmark(fens, limits);
+      return;
+  }
+
+  if (limitType == "attacks")
+  {
+      attacks_benchmark(fens, limits.depth);
+      return;
+  }
+
   uint64_t nodes = 0;
+  int64_t optimumTime = 0, usedTime = 0;
+  int early = 0, extended = 0;
   Search::StateStackPtr st;
   Time::point elapsed = Time::now();
 
   for (size_t i = 0; i < fens.size(); ++i)
   {
-      Position pos(fens[i], Options["UCI_Chess960"], Threads.main());
+      Position pos(fens[i], Options["UCI_Chess960"], UCIEngine.threads.main());
 
       cerr << "\nPosition: " << i + 1 << '/' << fens.size() << endl;
 
@@ -143,9 +307,28 @@ void benchmark(const Position& current, istream& is) {
 
       else
       {
-          Threads.start_thinking(pos, limits, st);
-          Threads.wait_for_think_finished();
-          nodes += Search::RootPos.nodes_searched();
+          Time::point searchTime = Time::now();
+
+          UCIEngine.threads.start_thinking(pos, limits, st);
+          UCIEngine.threads.wait_for_think_finished();
+          nodes += UCIEngine.rootPos.nodes_searched();
+
+          if (limitType == "clock")
+          {
+              TimeManager tm;
+              tm.init(limits, pos.game_ply(), pos.side_to_move());
+
+              int optimum = tm.available_time();
+              int used = int(Time::now() - searchTime);
+
+              optimumTime += optimum;
+              usedTime += used;
+              early += used < optimum;
+              extended += used > optimum;
+
+              cerr << "Time used (ms)  : " << used << " of optimum " << optimum
+                   << " and maximum " << tm.maximum_time() << endl;
+          }
       }
   }
 
@@ -157,4 +340,49 @@ void benchmark(const Position& current, istream& is) {
        << "\nTotal time (ms) : " << elapsed
        << "\nNodes searched  : " << nodes
        << "\nNodes/second    : " << 1000 * nodes / elapsed << endl;
+
+  uint64_t probes = 0, hits = 0;
+  Eval::Stats stats;
+  Search::NodeStats nodeStats;
+
+  for (size_t i = 0; i < UCIEngine.threads.size(); ++i)
+  {
+      probes += UCIEngine.threads[i]->evalTable.probes;
+      hits += UCIEngine.threads[i]->evalTable.hits;
+      stats.calls += UCIEngine.threads[i]->evalStats.calls;
+
+      for (int s = 0; s < Eval::LAZY_STAGE_NB; ++s)
+          stats.lazy[s] += UCIEngine.threads[i]->evalStats.lazy[s];
+
+      for (int k = 0; k < Search::NODE_KIND_NB; ++k)
+      {
+          nodeStats.nodes[k] += UCIEngine.threads[i]->nodeStats.nodes[k];
+          nodeStats.moves[k] += UCIEngine.threads[i]->nodeStats.moves[k];
+      }
+  }
+
+  if (probes)
+      cerr << "Eval hash hits  : " << hits << " of " << probes
+           << " (" << 100 * hits / probes << "%)" << endl;
+
+  if (stats.calls)
+      cerr << "Evaluations     : " << stats.calls
+           << "\nLazy, material  : " << stats.lazy[Eval::LAZY_MATERIAL]
+           << " (" << 100 * stats.lazy[Eval::LAZY_MATERIAL] / stats.calls << "%)"
+           << "\nLazy, pieces    : " << stats.lazy[Eval::LAZY_PIECES]
+           << " (" << 100 * stats.lazy[Eval::LAZY_PIECES] / stats.calls << "%)" << endl;
+
+  const char* kinds[] = { "PV nodes        : ", "Cut nodes       : ", "All nodes       : " };
+
+  for (int k = 0; k < Search::NODE_KIND_NB; ++k)
+      if (nodeStats.nodes[k])
+          cerr << kinds[k] << nodeStats.nodes[k] << ", "
+               << double(nodeStats.moves[k]) / nodeStats.nodes[k] << " moves tried" << endl;
+
+  if (limitType == "clock")
+      cerr << "Optimum time    : " << optimumTime
+           << "\nTime used       : " << usedTime
+           << " (" << 100 * usedTime / std::max(optimumTime, int64_t(1)) << "% of optimum)"
+           << "\nStopped early   : " << early << '/' << fens.size()
+           << "\nExtended        : " << extended << '/' << fens.size() << endl;
 }
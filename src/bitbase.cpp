@@ -21,6 +21,8 @@
 #include <vector>
 
 #include "bitboard.h"
+#include "tables.h"
+#include "thread.h"
 #include "types.h"
 
 namespace {
@@ -31,6 +33,14 @@ namespace {
   // Each uint32_t stores results of 32 positions, one per bit
   uint32_t KPKBitbase[MAX_INDEX / 32];
 
+  // The bitbase in use, either the one above or the precomputed one. It is set
+  // up by init_kpk() when the first thread fills its endgame maps, so that the
+  // processes that never search do not pay for it. KPKReady is read only under
+  // KPKMutex, which also makes the bitbase visible to each thread taking it.
+  const uint32_t* Bitbase = KPKBitbase;
+  bool KPKReady = false;
+  Mutex KPKMutex;
+
   // A KPK bitbase index is an integer in [0, IndexMax] range
   //
   // Information is mapped in a way that minimizes the number of iterations:
@@ -68,43 +78,70 @@ namespace {
     Result result;
   };
 
+  void compute_kpk();
+
 } // namespace
 
 
 bool Bitbases::probe_kpk(Square wksq, Square wpsq, Square bksq, Color us) {
 
   assert(file_of(wpsq) <= FILE_D);
+  assert(KPKReady);
 
   unsigned idx = index(us, bksq, wksq, wpsq);
-  return KPKBitbase[idx / 32] & (1 << (idx & 0x1F));
+  return Bitbase[idx / 32] & (1 << (idx & 0x1F));
+}
+
+
+const uint32_t* Bitbases::kpk_bitbase() {
+
+  return Bitbase;
 }
 
 
 void Bitbases::init_kpk() {
 
-  unsigned idx, repeat = 1;
-  std::vector<KPKPosition> db;
-  db.reserve(MAX_INDEX);
+  KPKMutex.lock();
 
-  // Initialize db with known win / draw positions
-  for (idx = 0; idx < MAX_INDEX; ++idx)
-      db.push_back(KPKPosition(idx));
+  if (!KPKReady)
+  {
+      if (Tables::Precomputed)
+          Bitbase = Tables::KPKBitbase;
+      else
+          compute_kpk();
 
-  // Iterate through the positions until none of the unknown positions can be
-  // changed to either wins or draws (15 cycles needed).
-  while (repeat)
-      for (repeat = idx = 0; idx < MAX_INDEX; ++idx)
-          repeat |= (db[idx] == UNKNOWN && db[idx].classify(db) != UNKNOWN);
+      KPKReady = true;
+  }
 
-  // Map 32 results into one KPKBitbase[] entry
-  for (idx = 0; idx < MAX_INDEX; ++idx)
-      if (db[idx] == WIN)
-          KPKBitbase[idx / 32] |= 1 << (idx & 0x1F);
+  KPKMutex.unlock();
 }
 
 
 namespace {
 
+  void compute_kpk() {
+
+    unsigned idx, repeat = 1;
+    std::vector<KPKPosition> db;
+    db.reserve(MAX_INDEX);
+
+    // Initialize db with known win / draw positions
+    for (idx = 0; idx < MAX_INDEX; ++idx)
+        db.push_back(KPKPosition(idx));
+
+    // Iterate through the positions until none of the unknown positions can be
+    // changed to either wins or draws (15 cycles needed).
+    while (repeat)
+        for (repeat = idx = 0; idx < MAX_INDEX; ++idx)
+            repeat |= (db[idx] == UNKNOWN && db[idx].classify(db) != UNKNOWN);
+
+    // Map 32 results into one KPKBitbase[] entry
+    for (idx = 0; idx < MAX_INDEX; ++idx)
+        if (db[idx] == WIN)
+            KPKBitbase[idx / 32] |= 1 << (idx & 0x1F);
+  }
+
+
   KPKPosition::KPKPosition(unsigned idx) {
 
     wksq   = Square((idx >>  0) & 0x3F);
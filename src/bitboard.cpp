@@ -20,20 +20,25 @@
 #include <algorithm>
 #include <cstring> // For memset
 
+#ifdef USE_DISPATCH
+#  include <cpuid.h>
+#endif
+
 #include "bitboard.h"
 #include "bitcount.h"
 #include "rkiss.h"
+#include "tables.h"
 
 CACHE_LINE_ALIGNMENT
 
 Bitboard RMasks[SQUARE_NB];
 Bitboard RMagics[SQUARE_NB];
-Bitboard* RAttacks[SQUARE_NB];
+SliderAttacks* RAttacks[SQUARE_NB];
 unsigned RShifts[SQUARE_NB];
 
 Bitboard BMasks[SQUARE_NB];
 Bitboard BMagics[SQUARE_NB];
-Bitboard* BAttacks[SQUARE_NB];
+SliderAttacks* BAttacks[SQUARE_NB];
 unsigned BShifts[SQUARE_NB];
 
 Bitboard SquareBB[SQUARE_NB];
@@ -44,7 +49,6 @@ Bitboard InFrontBB[COLOR_NB][RANK_NB];
 Bitboard StepAttacksBB[PIECE_NB][SQUARE_NB];
 Bitboard BetweenBB[SQUARE_NB][SQUARE_NB];
 Bitboard LineBB[SQUARE_NB][SQUARE_NB];
-Bitboard DistanceRingsBB[SQUARE_NB][8];
 Bitboard ForwardBB[COLOR_NB][SQUARE_NB];
 Bitboard PassedPawnMask[COLOR_NB][SQUARE_NB];
 Bitboard PawnAttackSpan[COLOR_NB][SQUARE_NB];
@@ -52,6 +56,48 @@ Bitboard PseudoAttacks[PIECE_TYPE_NB][SQUARE_NB];
 
 int SquareDistance[SQUARE_NB][SQUARE_NB];
 
+#ifdef USE_DISPATCH
+
+namespace {
+
+  // cpu_has_popcnt() and cpu_has_fast_pext() read the features of the running
+  // CPU with the cpuid instruction. AMD CPUs before Zen 3 implement pext in
+  // microcode, much slower than the magic multiplication, so they are left out.
+
+  bool cpu_has_popcnt() {
+
+    unsigned eax, ebx, ecx, edx;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_POPCNT);
+  }
+
+  bool cpu_has_fast_pext() {
+
+    unsigned eax, ebx, ecx, edx;
+
+    if (__get_cpuid_max(0, NULL) < 7)
+        return false;
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+    if (!(ebx & bit_BMI2))
+        return false;
+
+    __cpuid(0, eax, ebx, ecx, edx);
+    bool amd = (ebx == 0x68747541); // "Auth" of "AuthenticAMD"
+
+    __cpuid(1, eax, ebx, ecx, edx);
+    unsigned family = ((eax >> 8) & 0xF) + ((eax >> 20) & 0xFF);
+
+    return !amd || family >= 0x19;
+  }
+
+} // namespace
+
+bool HasPopCnt = false; // Set by Bitboards::init()
+bool HasPext = false;
+
+#endif
+
 namespace {
 
   // De Bruijn sequences. See chessprogramming.wikispaces.com/BitScan
@@ -62,12 +108,14 @@ namespace {
 
   int MS1BTable[256];
   Square BSFTable[SQUARE_NB];
-  Bitboard RTable[0x19000]; // Storage space for rook attacks
-  Bitboard BTable[0x1480];  // Storage space for bishop attacks
+  SliderAttacks RTable[0x19000]; // Storage space for rook attacks
+  SliderAttacks BTable[0x1480];  // Storage space for bishop attacks
 
   typedef unsigned (Fn)(Square, Bitboard);
 
-  void init_magics(Bitboard table[], Bitboard* attacks[], Bitboard magics[],
+  Bitboard sliding_attack(Square deltas[], Square sq, Bitboard occupied);
+
+  void init_magics(SliderAttacks table[], SliderAttacks* attacks[], Bitboard magics[], const Bitboard known[],
                    Bitboard masks[], unsigned shifts[], Square deltas[], Fn index);
 
   FORCE_INLINE unsigned bsf_index(Bitboard b) {
@@ -144,9 +192,18 @@ const std::string Bitboards::pretty(Bitboard b) {
 
 
 /// Bitboards::init() initializes various bitboard tables. It is called at
-/// startup and relies on global objects to be already zero-initialized.
+/// startup and relies on global objects to be already zero-initialized. In a
+/// dispatch build it first reads the CPU features, and 'magics' keeps pext off
+/// so that the magics are computed also on a CPU with pext, as gentables needs.
 
-void Bitboards::init() {
+void Bitboards::init(bool magics) {
+
+#ifdef USE_DISPATCH
+  HasPopCnt = cpu_has_popcnt();
+  HasPext = !magics && cpu_has_fast_pext();
+#else
+  (void)magics;
+#endif
 
   for (Square s = SQ_A1; s <= SQ_H8; ++s)
   {
@@ -179,11 +236,7 @@ void Bitboards::init() {
 
   for (Square s1 = SQ_A1; s1 <= SQ_H8; ++s1)
       for (Square s2 = SQ_A1; s2 <= SQ_H8; ++s2)
-          if (s1 != s2)
-          {
-              SquareDistance[s1][s2] = std::max(file_distance(s1, s2), rank_distance(s1, s2));
-              DistanceRingsBB[s1][SquareDistance[s1][s2] - 1] |= s2;
-          }
+          SquareDistance[s1][s2] = std::max(file_distance(s1, s2), rank_distance(s1, s2));
 
   int steps[][9] = { {}, { 7, 9 }, { 17, 15, 10, 6, -6, -10, -15, -17 },
                      {}, {}, {}, { 9, 7, -7, -9, 8, 1, -1, -8 } };
@@ -202,8 +255,18 @@ void Bitboards::init() {
   Square RDeltas[] = { DELTA_N,  DELTA_E,  DELTA_S,  DELTA_W  };
   Square BDeltas[] = { DELTA_NE, DELTA_SE, DELTA_SW, DELTA_NW };
 
-  init_magics(RTable, RAttacks, RMagics, RMasks, RShifts, RDeltas, magic_index<ROOK>);
-  init_magics(BTable, BAttacks, BMagics, BMasks, BShifts, BDeltas, magic_index<BISHOP>);
+  const Bitboard* RKnown = Tables::Precomputed ? Tables::RookMagics : NULL;
+  const Bitboard* BKnown = Tables::Precomputed ? Tables::BishopMagics : NULL;
+
+  // The rays on an empty board are needed to expand the compact attacks
+  for (Square s = SQ_A1; s <= SQ_H8; ++s)
+  {
+      PseudoAttacks[ROOK][s] = sliding_attack(RDeltas, s, 0);
+      PseudoAttacks[BISHOP][s] = sliding_attack(BDeltas, s, 0);
+  }
+
+  init_magics(RTable, RAttacks, RMagics, RKnown, RMasks, RShifts, RDeltas, magic_index<ROOK>);
+  init_magics(BTable, BAttacks, BMagics, BKnown, BMasks, BShifts, BDeltas, magic_index<BISHOP>);
 
   for (Square s1 = SQ_A1; s1 <= SQ_H8; ++s1)
   {
@@ -227,6 +290,18 @@ void Bitboards::init() {
 
 namespace {
 
+  // compress() returns the attacks as stored in the tables, see SliderAttacks
+
+  SliderAttacks compress(Bitboard attacks, Bitboard rays) {
+#ifdef USE_COMPACT_ATTACKS
+    return SliderAttacks(_pext_u64(attacks, rays));
+#else
+    (void)rays;
+    return attacks;
+#endif
+  }
+
+
   Bitboard sliding_attack(Square deltas[], Square sq, Bitboard occupied) {
 
     Bitboard attack = 0;
@@ -251,13 +326,13 @@ namespace {
   // chessprogramming.wikispaces.com/Magic+Bitboards. In particular, here we
   // use the so called "fancy" approach.
 
-  void init_magics(Bitboard table[], Bitboard* attacks[], Bitboard magics[],
+  void init_magics(SliderAttacks table[], SliderAttacks* attacks[], Bitboard magics[], const Bitboard known[],
                    Bitboard masks[], unsigned shifts[], Square deltas[], Fn index) {
 
     int MagicBoosters[][RANK_NB] = { {  969, 1976, 2850,  542, 2069, 2852, 1708,  164 },
                                      { 3101,  552, 3555,  926,  834,   26, 2131, 1117 } };
     RKISS rk;
-    Bitboard occupancy[4096], reference[4096], edges, b;
+    Bitboard occupancy[4096], reference[4096], edges, rays, b;
     int i, size, booster;
 
     // attacks[s] is a pointer to the beginning of the attacks table for square 's'
@@ -273,7 +348,8 @@ namespace {
         // all the attacks for each possible subset of the mask and so is 2 power
         // the number of 1s of the mask. Hence we deduce the size of the shift to
         // apply to the 64 or 32 bits word to get the index.
-        masks[s]  = sliding_attack(deltas, s, 0) & ~edges;
+        rays = sliding_attack(deltas, s, 0);
+        masks[s]  = rays & ~edges;
         shifts[s] = (Is64Bit ? 64 : 32) - popcount<Max15>(masks[s]);
 
         // Use Carry-Rippler trick to enumerate all subsets of masks[s] and
@@ -284,7 +360,7 @@ namespace {
             reference[size] = sliding_attack(deltas, s, b);
 
             if (HasPext)
-                attacks[s][_pext_u64(b, masks[s])] = reference[size];
+                attacks[s][_pext_u64(b, masks[s])] = compress(reference[size], rays);
 
             size++;
             b = (b - masks[s]) & masks[s];
@@ -301,11 +377,15 @@ namespace {
         booster = MagicBoosters[Is64Bit][rank_of(s)];
 
         // Find a magic for square 's' picking up an (almost) random number
-        // until we find the one that passes the verification test.
+        // until we find the one that passes the verification test. Magics
+        // computed at build time pass it at the first try.
         do {
-            do
-                magics[s] = rk.magic_rand<Bitboard>(booster);
-            while (popcount<Max15>((magics[s] * masks[s]) >> 56) < 6);
+            if (known)
+                magics[s] = known[s];
+            else
+                do
+                    magics[s] = rk.magic_rand<Bitboard>(booster);
+                while (popcount<Max15>((magics[s] * masks[s]) >> 56) < 6);
 
             std::memset(attacks[s], 0, size * sizeof(Bitboard));
 
@@ -315,15 +395,18 @@ namespace {
             // effect of verifying the magic.
             for (i = 0; i < size; ++i)
             {
-                Bitboard& attack = attacks[s][index(s, occupancy[i])];
+                SliderAttacks& attack = attacks[s][index(s, occupancy[i])];
 
-                if (attack && attack != reference[i])
+                if (attack && attack != compress(reference[i], rays))
                     break;
 
                 assert(reference[i]);
 
-                attack = reference[i];
+                attack = compress(reference[i], rays);
             }
+
+            assert(!known || i == size); // Precomputed magics are always good
+
         } while (i < size);
     }
   }
@@ -26,7 +26,7 @@
 
 namespace Bitboards {
 
-void init();
+void init(bool magics = false);
 const std::string pretty(Bitboard b);
 
 }
@@ -35,6 +35,7 @@ namespace Bitbases {
 
 void init_kpk();
 bool probe_kpk(Square wksq, Square wpsq, Square bksq, Color us);
+const uint32_t* kpk_bitbase();
 
 }
 
@@ -56,16 +57,26 @@ const Bitboard Rank6BB = Rank1BB << (8 * 5);
 const Bitboard Rank7BB = Rank1BB << (8 * 6);
 const Bitboard Rank8BB = Rank1BB << (8 * 7);
 
+/// With compact tables each slider attack is stored as the 16 bit subset of the
+/// rays of the slider on an empty board, extracted with pext and expanded back
+/// with pdep, so the tables take a quarter of the space.
+
+#ifdef USE_COMPACT_ATTACKS
+typedef uint16_t SliderAttacks;
+#else
+typedef Bitboard SliderAttacks;
+#endif
+
 CACHE_LINE_ALIGNMENT
 
 extern Bitboard RMasks[SQUARE_NB];
 extern Bitboard RMagics[SQUARE_NB];
-extern Bitboard* RAttacks[SQUARE_NB];
+extern SliderAttacks* RAttacks[SQUARE_NB];
 extern unsigned RShifts[SQUARE_NB];
 
 extern Bitboard BMasks[SQUARE_NB];
 extern Bitboard BMagics[SQUARE_NB];
-extern Bitboard* BAttacks[SQUARE_NB];
+extern SliderAttacks* BAttacks[SQUARE_NB];
 extern unsigned BShifts[SQUARE_NB];
 
 extern Bitboard SquareBB[SQUARE_NB];
@@ -76,7 +87,6 @@ extern Bitboard InFrontBB[COLOR_NB][RANK_NB];
 extern Bitboard StepAttacksBB[PIECE_NB][SQUARE_NB];
 extern Bitboard BetweenBB[SQUARE_NB][SQUARE_NB];
 extern Bitboard LineBB[SQUARE_NB][SQUARE_NB];
-extern Bitboard DistanceRingsBB[SQUARE_NB][8];
 extern Bitboard ForwardBB[COLOR_NB][SQUARE_NB];
 extern Bitboard PassedPawnMask[COLOR_NB][SQUARE_NB];
 extern Bitboard PawnAttackSpan[COLOR_NB][SQUARE_NB];
@@ -255,7 +265,11 @@ FORCE_INLINE unsigned magic_index(Square s, Bitboard occ) {
 
 template<PieceType Pt>
 inline Bitboard attacks_bb(Square s, Bitboard occ) {
+#ifdef USE_COMPACT_ATTACKS
+  return _pdep_u64((Pt == ROOK ? RAttacks : BAttacks)[s][magic_index<Pt>(s, occ)], PseudoAttacks[Pt][s]);
+#else
   return (Pt == ROOK ? RAttacks : BAttacks)[s][magic_index<Pt>(s, occ)];
+#endif
 }
 
 inline Bitboard attacks_bb(Piece pc, Square s, Bitboard occ) {
@@ -269,6 +283,56 @@ inline Bitboard attacks_bb(Piece pc, Square s, Bitboard occ) {
   }
 }
 
+
+/// slider_attacks() returns the same bitboard as attacks_bb<Pt>() for a bishop
+/// or a rook. With AVX2 it is computed instead with a Kogge-Stone fill of the
+/// four directions of the slider, one per 64-bit lane, so that evaluation does
+/// not read the magic tables.
+
+#ifdef USE_AVX2
+
+inline __m256i shift_lanes(__m256i b, __m256i left, __m256i right) {
+  return _mm256_srlv_epi64(_mm256_sllv_epi64(b, left), right);
+}
+
+template<PieceType Pt>
+inline Bitboard slider_attacks(Square s, Bitboard occ) {
+
+  // Lanes are N, E, S, W for a rook and NE, NW, SW, SE for a bishop. Each one
+  // shifts left or right, and the mask drops the squares wrapped to the other
+  // side of the board.
+  __m256i left  = Pt == ROOK ? _mm256_set_epi64x(0, 0, 1, 8) : _mm256_set_epi64x(0, 0, 7, 9);
+  __m256i right = Pt == ROOK ? _mm256_set_epi64x(1, 8, 0, 0) : _mm256_set_epi64x(7, 9, 0, 0);
+  __m256i mask  = Pt == ROOK ? _mm256_set_epi64x(~FileHBB, ~0ULL, ~FileABB, ~0ULL)
+                             : _mm256_set_epi64x(~FileABB, ~FileHBB, ~FileHBB, ~FileABB);
+
+  __m256i gen = _mm256_set1_epi64x(SquareBB[s]);
+  __m256i pro = _mm256_and_si256(_mm256_set1_epi64x(~occ), mask);
+  __m256i l = left, r = right;
+
+  for (int i = 0; i < 3; ++i)
+  {
+      gen = _mm256_or_si256(gen, _mm256_and_si256(pro, shift_lanes(gen, l, r)));
+      pro = _mm256_and_si256(pro, shift_lanes(pro, l, r));
+      l = _mm256_slli_epi64(l, 1);
+      r = _mm256_slli_epi64(r, 1);
+  }
+
+  __m256i b = _mm256_and_si256(shift_lanes(gen, left, right), mask);
+  __m128i x = _mm_or_si128(_mm256_castsi256_si128(b), _mm256_extracti128_si256(b, 1));
+
+  return Bitboard(_mm_cvtsi128_si64(x) | _mm_extract_epi64(x, 1));
+}
+
+#else
+
+template<PieceType Pt>
+inline Bitboard slider_attacks(Square s, Bitboard occ) {
+  return attacks_bb<Pt>(s, occ);
+}
+
+#endif
+
 /// lsb()/msb() finds the least/most significant bit in a non-zero bitboard.
 /// pop_lsb() finds and clears the least significant bit in a non-zero bitboard.
 
@@ -34,9 +34,15 @@ enum BitCountType {
 
 /// Determine at compile time the best popcount<> specialization according to
 /// whether the platform is 32 or 64 bit, the maximum number of non-zero
-/// bits to count and if the hardware popcnt instruction is available.
+/// bits to count and if the hardware popcnt instruction is available. With
+/// runtime dispatch popcount<CNT_HW_POPCNT> checks the CPU instead.
+#ifdef USE_DISPATCH
+const BitCountType Full  = CNT_HW_POPCNT;
+const BitCountType Max15 = CNT_HW_POPCNT;
+#else
 const BitCountType Full  = HasPopCnt ? CNT_HW_POPCNT : Is64Bit ? CNT_64 : CNT_32;
 const BitCountType Max15 = HasPopCnt ? CNT_HW_POPCNT : Is64Bit ? CNT_64_MAX15 : CNT_32_MAX15;
+#endif
 
 
 /// popcount() counts the number of non-zero bits in a bitboard
@@ -81,7 +87,15 @@ inline int popcount<CNT_32_MAX15>(Bitboard b) {
 template<>
 inline int popcount<CNT_HW_POPCNT>(Bitboard b) {
 
-#ifndef USE_POPCNT
+#if defined(USE_DISPATCH)
+
+  if (!HasPopCnt)
+      return popcount<CNT_64>(b);
+
+  __asm__("popcntq %1, %0" : "=r"(b) : "rm"(b));
+  return int(b);
+
+#elif !defined(USE_POPCNT)
 
   assert(false);
   return b != 0; // Avoid 'b not used' warning
@@ -0,0 +1,289 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2014 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bitboard.h"
+#include "engine.h"
+#include "evaluate.h"
+#include "notation.h"
+#include "stockfish.h"
+#include "ucioption.h"
+
+using std::string;
+
+/// sf_engine keeps together an engine, the position to search and the callback
+/// of the running search.
+
+struct sf_engine {
+  Engine engine;
+  Position pos;
+  Search::StateStackPtr states;
+  sf_info_callback callback;
+  void* data;
+};
+
+namespace {
+
+  // FEN string of the initial position, normal chess
+  const char* StartFEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+  // Options that are set per engine and so cannot be set with sf_set_option()
+  const char* EngineOptions[] = { "Threads", "Min Split Depth", "Hash", "Eval Hash", "Clear Hash" };
+
+  // The options are read by the searches of all the engines, so they are set
+  // only when no search is running. The count of the searches is kept under
+  // the lock taken to set an option, so a search cannot start meanwhile.
+  Mutex OptionsMutex;
+  int Searching = 0;
+
+
+  // on_pv() is the engine hook passing the PV lines to the user callback. The
+  // lines are the same printed by uci_pv() in search.cpp.
+
+  void on_pv(const Engine& e, int depth, Value alpha, Value beta) {
+
+    const sf_engine* sf = (const sf_engine*)e.userData;
+    size_t multiPV = std::min((size_t)Options["MultiPV"], e.rootMoves.size());
+    int selDepth = 0;
+    std::vector<sf_move> pv;
+    sf_info info;
+
+    if (!sf->callback)
+        return;
+
+    for (size_t i = 0; i < e.threads.size(); ++i)
+        selDepth = std::max(selDepth, e.threads[i]->maxPly);
+
+    for (size_t i = 0; i < multiPV; ++i)
+    {
+        bool updated = (i <= e.pvIdx);
+
+        if (depth == 1 && !updated)
+            continue;
+
+        const Search::RootMove& rm = e.rootMoves[i];
+        Value v = updated ? rm.score : rm.prevScore;
+
+        pv.clear();
+        for (size_t j = 0; rm.pv[j] != MOVE_NONE; ++j)
+            pv.push_back(sf_move(rm.pv[j]));
+
+        info.depth    = updated ? depth : depth - 1;
+        info.seldepth = selDepth;
+        info.multipv  = int(i + 1);
+        info.mate     = abs(v) >= VALUE_MATE_IN_MAX_PLY;
+        info.score    =  info.mate ? (v > 0 ? VALUE_MATE - v + 1 : -VALUE_MATE - v) / 2
+                                   : v * 100 / PawnValueEg;
+        info.bound    =  i != e.pvIdx ? SF_BOUND_EXACT
+                       : v >= beta    ? SF_BOUND_LOWER
+                       : v <= alpha   ? SF_BOUND_UPPER : SF_BOUND_EXACT;
+        info.nodes    = e.rootPos.nodes_searched();
+        info.time     = int(Time::now() - e.searchTime + 1);
+        info.pv       = pv.empty() ? NULL : &pv[0];
+        info.pvLength = int(pv.size());
+
+        sf->callback(&info, sf->data);
+    }
+  }
+
+} // namespace
+
+
+/// The C interface, see stockfish.h
+
+void sf_init() {
+
+  UCI::init(Options);
+  Bitboards::init();
+  Position::init();
+  Search::init();
+  Pawns::init();
+  Eval::init();
+}
+
+
+int sf_set_option(const char* name, const char* value) {
+
+  UCI::CaseInsensitiveLess less;
+
+  for (size_t i = 0; i < sizeof(EngineOptions) / sizeof(char*); ++i)
+      if (!less(name, EngineOptions[i]) && !less(EngineOptions[i], name))
+          return -1;
+
+  if (!Options.count(name))
+      return -1;
+
+  OptionsMutex.lock();
+
+  bool idle = !Searching;
+
+  if (idle)
+      Options[name] = string(value ? value : "");
+
+  OptionsMutex.unlock();
+
+  return idle ? 0 : -2;
+}
+
+
+sf_engine* sf_engine_new(int threads, int hashMb) {
+
+  sf_engine* sf = new sf_engine;
+
+  sf->engine.init(std::min(std::max(threads, 1), MAX_THREADS), std::max(hashMb, 1));
+  sf->engine.onPv = on_pv;
+  sf->engine.userData = sf;
+  sf->callback = NULL;
+  sf->data = NULL;
+
+  sf_set_position(sf, NULL, NULL);
+  return sf;
+}
+
+
+void sf_engine_delete(sf_engine* sf) {
+
+  sf->engine.threads.wait_for_think_finished();
+  sf->engine.exit();
+  delete sf;
+}
+
+
+void sf_clear_hash(sf_engine* sf) {
+
+  sf->engine.tt.clear();
+}
+
+
+void sf_set_eval_hash(sf_engine* sf, int mb) {
+
+  sf->engine.threads.wait_for_think_finished();
+  sf->engine.threads.set_eval_hash(std::min(std::max(mb, 0), 1024));
+}
+
+
+int sf_set_position(sf_engine* sf, const char* fen, const char* moves) {
+
+  std::istringstream is(moves ? moves : "");
+  string token;
+  Move m;
+
+  // Set up a new position and keep it only if all the moves are legal
+  Position pos(fen ? fen : StartFEN, Options["UCI_Chess960"], sf->engine.threads.main());
+  Search::StateStackPtr states(new std::stack<StateInfo>());
+
+  while (is >> token)
+  {
+      if ((m = move_from_uci(pos, token)) == MOVE_NONE)
+          return -1;
+
+      states->push(StateInfo());
+      pos.do_move(m, states->top());
+  }
+
+  sf->pos = pos; // The copy keeps the links to the states for repetitions
+  sf->states = states;
+  return 0;
+}
+
+
+sf_move sf_search(sf_engine* sf, const sf_limits* limits,
+                  sf_info_callback callback, void* data, sf_move* ponder) {
+
+  Search::LimitsType l;
+
+  if (limits)
+  {
+      l.time[WHITE] = limits->time[0];
+      l.time[BLACK] = limits->time[1];
+      l.inc[WHITE]  = limits->inc[0];
+      l.inc[BLACK]  = limits->inc[1];
+      l.movestogo   = limits->movestogo;
+      l.depth       = limits->depth;
+      l.nodes       = limits->nodes;
+      l.movetime    = limits->movetime;
+      l.mate        = limits->mate;
+  }
+
+  l.infinite = !(l.time[WHITE] | l.time[BLACK] | l.depth | l.nodes | l.movetime | l.mate);
+
+  sf->engine.threads.wait_for_think_finished();
+  sf->callback = callback;
+  sf->data = data;
+
+  OptionsMutex.lock();
+  ++Searching;
+  OptionsMutex.unlock();
+
+  sf->engine.threads.start_thinking(sf->pos, l, sf->states);
+  sf->engine.threads.wait_for_think_finished();
+
+  OptionsMutex.lock();
+  --Searching;
+  OptionsMutex.unlock();
+
+  const Search::RootMove& rm = sf->engine.rootMoves[0];
+
+  if (ponder)
+      *ponder = sf_move(rm.pv[0] != MOVE_NONE ? rm.pv[1] : MOVE_NONE);
+
+  return sf_move(rm.pv[0]);
+}
+
+
+void sf_stop(sf_engine* sf) {
+
+  sf->engine.signals.stop = true;
+  sf->engine.threads.main()->notify_one(); // Could be sleeping
+}
+
+
+int sf_eval(sf_engine* sf, int* score) {
+
+  if (sf->pos.checkers())
+      return -1;
+
+  *score = Eval::evaluate(sf->pos) * 100 / PawnValueEg;
+  return 0;
+}
+
+
+uint64_t sf_perft(sf_engine* sf, int depth) {
+
+  return depth <= 0 ? 1
+       : depth == 1 ? MoveList<LEGAL>(sf->pos).size()
+                    : Search::perft<false>(sf->pos, depth * ONE_PLY);
+}
+
+
+int sf_move_to_uci(sf_engine* sf, sf_move m, char* buf, int size) {
+
+  string s = move_to_uci(Move(m), sf->pos.is_chess960());
+
+  if (int(s.size()) >= size)
+      return -1;
+
+  std::strcpy(buf, s.c_str());
+  return int(s.size());
+}
@@ -107,7 +107,10 @@ namespace {
 
 /// Endgames members definitions
 
-Endgames::Endgames() {
+void Endgames::init() {
+
+  // The endgame functions probing the KPK bitbase are reachable only from here
+  Bitbases::init_kpk();
 
   add<KPK>("KPK");
   add<KNNK>("KNNK");
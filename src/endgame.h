@@ -109,13 +109,18 @@ class Endgames {
   M2& map(M2::mapped_type) { return m2; }
 
   template<EndgameType E> void add(const std::string& code);
+  void init();
 
 public:
-  Endgames();
  ~Endgames();
 
-  template<typename T> T probe(Key key, T& eg)
-  { return eg = map(eg).count(key) ? map(eg)[key] : NULL; }
+  // The maps are filled at the first probe, so that threads that never reach
+  // an endgame do not pay for it. Each thread has its own Endgames object.
+  template<typename T> T probe(Key key, T& eg) {
+    if (m1.empty())
+        init();
+    return eg = map(eg).count(key) ? map(eg)[key] : NULL;
+  }
 };
 
 #endif // #ifndef ENDGAME_H_INCLUDED
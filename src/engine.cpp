@@ -0,0 +1,53 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2014 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "engine.h"
+#include "ucioption.h"
+
+Engine UCIEngine; // The engine driven by the UCI front end
+
+
+/// Engine::init() launches the given number of threads and allocates the
+/// transposition table with the given size in MB, or none if zero, for an
+/// engine that will share the table of another one. They can be changed later
+/// calling ThreadPool::set_size() and TranspositionTable::resize().
+
+void Engine::init(size_t threadCount, size_t hashMb) {
+
+  signals.stop = signals.stopOnPonderhit = false;
+  signals.firstRootMove = signals.failedLowAtRoot = false;
+  pvIdx = sharedLines = 0;
+  pollTime = writeTimeTrace = false;
+  lastInfoTime = Time::now();
+  onPv = NULL;
+  userData = NULL;
+
+  threads.init(this, threadCount);
+
+  if (hashMb)
+      tt.resize(hashMb);
+}
+
+
+/// Engine::exit() terminates the threads. Any search must be already finished.
+
+void Engine::exit() {
+
+  threads.exit();
+}
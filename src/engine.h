@@ -0,0 +1,83 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2014 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ENGINE_H_INCLUDED
+#define ENGINE_H_INCLUDED
+
+#include <sstream>
+#include <vector>
+
+#include "movepick.h"
+#include "position.h"
+#include "search.h"
+#include "thread.h"
+#include "timeman.h"
+#include "tt.h"
+
+/// Engine struct keeps together all the state of a search: the thread pool,
+/// the transposition table, the limits and signals of the current search and
+/// the statistics shared by the search threads. The lookup tables initialized
+/// at startup (bitboards, bitbases, PSQ and so on) are read-only and shared by
+/// all the engines, so a process can host many independent Engine objects,
+/// each one running its own search concurrently with the others.
+
+struct Engine {
+
+  // Hook receiving the PV lines of the search instead of the UCI output
+  typedef void (*OnPv)(const Engine& e, int depth, Value alpha, Value beta);
+
+  // No c'tor and d'tor, threads hold a pointer to the engine so it must be
+  // fully constructed when they are launched.
+  void init(size_t threadCount, size_t hashMb);
+  void exit();
+
+  ThreadPool threads;
+  TranspositionTable tt;
+
+  // Data of the current search, set by ThreadPool::start_thinking()
+  volatile Search::SignalsType signals;
+  Search::LimitsType limits;
+  std::vector<Search::RootMove> rootMoves;
+  Position rootPos;
+  Time::point searchTime;
+  Search::StateStackPtr setupStates;
+
+  // Search state shared by the threads, see search.cpp
+  size_t pvIdx, sharedLines;
+  Value sharedAlpha;
+  std::vector<Move> sharedDone;
+  TimeManager timeMgr;
+  double bestMoveChanges;
+  Value drawValue[COLOR_NB];
+  HistoryStats history;
+  GainsStats gains;
+  MovesStats countermoves, followupmoves;
+  bool pollTime, writeTimeTrace;
+  Time::point lastInfoTime; // Of the debug info printed by check_time()
+  std::stringstream timeTrace;
+
+  // When an embedding application sets onPv, the search calls it with userData
+  // in place of printing "info" and "bestmove" lines, see capi.cpp.
+  OnPv onPv;
+  void* userData;
+};
+
+extern Engine UCIEngine;
+
+#endif // #ifndef ENGINE_H_INCLUDED
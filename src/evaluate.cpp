@@ -95,6 +95,10 @@ namespace {
     {289, 344}, {233, 201}, {221, 273}, {46, 0}, {318, 0}
   };
 
+  // LazyMargin[stage] is how much the terms not yet computed at a stage of the
+  // evaluation can change the rough value, see do_evaluate().
+  const Value LazyMargin[Eval::LAZY_STAGE_NB] = { Value(700), Value(450) };
+
   typedef Value V;
   #define S(mg, eg) make_score(mg, eg)
 
@@ -217,7 +221,7 @@ namespace {
 
     ei.pinnedPieces[Us] = pos.pinned_pieces(Us);
 
-    Bitboard b = ei.attackedBy[Them][KING] = pos.attacks_from<KING>(pos.king_square(Them));
+    Bitboard b = ei.attackedBy[Them][KING] = pos.attacks_of<KING>(pos.king_square(Them));
     ei.attackedBy[Us][ALL_PIECES] = ei.attackedBy[Us][PAWN] = ei.pi->pawn_attacks(Us);
 
     // Init king safety tables only if we are going to use them
@@ -278,9 +282,9 @@ namespace {
     while ((s = *pl++) != SQ_NONE)
     {
         // Find attacked squares, including x-ray attacks for bishops and rooks
-        b = Pt == BISHOP ? attacks_bb<BISHOP>(s, pos.pieces() ^ pos.pieces(Us, QUEEN))
-          : Pt ==   ROOK ? attacks_bb<  ROOK>(s, pos.pieces() ^ pos.pieces(Us, ROOK, QUEEN))
-                         : pos.attacks_from<Pt>(s);
+        b = Pt == BISHOP ? slider_attacks<BISHOP>(s, pos.pieces() ^ pos.pieces(Us, QUEEN))
+          : Pt ==   ROOK ? slider_attacks<  ROOK>(s, pos.pieces() ^ pos.pieces(Us, ROOK, QUEEN))
+                         : pos.attacks_of<Pt>(s);
 
         if (ei.pinnedPieces[Us] & s)
             b &= LineBB[pos.king_square(Us)][s];
@@ -670,16 +674,40 @@ namespace {
   }
 
 
-  // do_evaluate() is the evaluation entry point, called directly from evaluate()
+  // lazy_value() is a rough evaluation, from the side to move point of view,
+  // of the terms computed so far, used to decide a lazy exit. It ignores the
+  // scaling of the opposite bishops and pawn span endgames.
+
+  Value lazy_value(const Position& pos, const EvalInfo& ei, Score score) {
+
+    Color strongSide = eg_value(score) > VALUE_DRAW ? WHITE : BLACK;
+    int sf = ei.mi->scale_factor(pos, strongSide);
+
+    Value v =  mg_value(score) * int(ei.mi->game_phase())
+             + eg_value(score) * int(PHASE_MIDGAME - ei.mi->game_phase()) * sf / SCALE_FACTOR_NORMAL;
+
+    v /= int(PHASE_MIDGAME);
+
+    return pos.side_to_move() == WHITE ? v : -v;
+  }
 
-  template<bool Trace>
-  Value do_evaluate(const Position& pos) {
+
+  // do_evaluate() is the evaluation entry point, called directly from evaluate().
+  // With Lazy, when the rough value of the terms computed so far is outside the
+  // (alpha, beta) window by more than the margin of the stage, the remaining
+  // terms cannot bring it back and the rough value is returned with 'lazy' set.
+
+  template<bool Trace, bool Lazy>
+  Value do_evaluate(const Position& pos, Value alpha, Value beta, bool& lazy) {
 
     assert(!pos.checkers());
 
     EvalInfo ei;
     Score score, mobility[2] = { SCORE_ZERO, SCORE_ZERO };
     Thread* thisThread = pos.this_thread();
+    Value v;
+
+    lazy = false;
 
     // Initialize score by reading the incrementally updated scores included
     // in the position object (material + piece square tables).
@@ -699,6 +727,18 @@ namespace {
     ei.pi = Pawns::probe(pos, thisThread->pawnsTable);
     score += apply_weight(ei.pi->pawns_value(), Weights[PawnStructure]);
 
+    // Skip everything else when material and pawns are far outside the window
+    if (   Lazy
+        && (   (v = lazy_value(pos, ei, score)) >= beta + LazyMargin[Eval::LAZY_MATERIAL]
+            ||  v <= alpha - LazyMargin[Eval::LAZY_MATERIAL]))
+    {
+#ifdef USE_NODE_STATS
+        thisThread->evalStats.lazy[Eval::LAZY_MATERIAL]++;
+#endif
+        lazy = true;
+        return v;
+    }
+
     // Initialize attack and king safety bitboards
     init_eval_info<WHITE>(pos, ei);
     init_eval_info<BLACK>(pos, ei);
@@ -714,6 +754,18 @@ namespace {
     score += evaluate_pieces<KNIGHT, WHITE, Trace>(pos, ei, mobility, mobilityArea);
     score += apply_weight(mobility[WHITE] - mobility[BLACK], Weights[Mobility]);
 
+    // Skip king safety, threats, passed pawns and space when still far outside
+    if (   Lazy
+        && (   (v = lazy_value(pos, ei, score)) >= beta + LazyMargin[Eval::LAZY_PIECES]
+            ||  v <= alpha - LazyMargin[Eval::LAZY_PIECES]))
+    {
+#ifdef USE_NODE_STATS
+        thisThread->evalStats.lazy[Eval::LAZY_PIECES]++;
+#endif
+        lazy = true;
+        return v;
+    }
+
     // Evaluate kings after all other pieces because we need complete attack
     // information when computing the king safety evaluation.
     score +=  evaluate_king<WHITE, Trace>(pos, ei)
@@ -772,8 +824,8 @@ namespace {
     }
 
     // Interpolate between a middlegame and a (scaled by 'sf') endgame score
-    Value v =  mg_value(score) * int(ei.mi->game_phase())
-             + eg_value(score) * int(PHASE_MIDGAME - ei.mi->game_phase()) * sf / SCALE_FACTOR_NORMAL;
+    v =  mg_value(score) * int(ei.mi->game_phase())
+       + eg_value(score) * int(PHASE_MIDGAME - ei.mi->game_phase()) * sf / SCALE_FACTOR_NORMAL;
 
     v /= int(PHASE_MIDGAME);
 
@@ -833,7 +885,8 @@ namespace {
 
     std::memset(terms, 0, sizeof(terms));
 
-    Value v = do_evaluate<true>(pos);
+    bool lazy;
+    Value v = do_evaluate<true, false>(pos, -VALUE_INFINITE, VALUE_INFINITE, lazy);
     v = pos.side_to_move() == WHITE ? v : -v; // White's point of view
 
     std::stringstream ss;
@@ -869,10 +922,77 @@ namespace {
 namespace Eval {
 
   /// evaluate() is the main evaluation function. It returns a static evaluation
-  /// of the position always from the point of view of the side to move.
+  /// of the position always from the point of view of the side to move. In a
+  /// build with lazyeval=yes, when the caller passes its (alpha, beta) window,
+  /// the evaluation may return early with a rough value if the position is
+  /// clearly outside of it. Such values are not stored in the evaluation cache,
+  /// and are flagged in 'lazyExit' so that the caller can keep them out of the
+  /// transposition table too.
+
+  Value evaluate(const Position& pos, Value alpha, Value beta, bool* lazyExit) {
+
+    Thread* thisThread = pos.this_thread();
+    Table& entries = thisThread->evalTable;
+    HashEntry* e = NULL;
+    uint32_t key32 = pos.key() >> 32;
+    bool lazy;
+
+    if (lazyExit)
+        *lazyExit = false;
+
+#ifdef USE_NODE_STATS
+    thisThread->evalStats.calls++;
+#endif
+
+    if (!entries.table.empty())
+    {
+        e = entries[pos.key()];
+
+#ifdef USE_NODE_STATS
+        entries.probes++;
+        entries.hits += (e->key32 == key32);
+#endif
+
+        if (e->key32 == key32)
+            return Value(e->value);
+    }
+
+#ifdef USE_LAZY_EVAL
+    // Only a finite window can give a lazy exit, search() always passes none
+    Value v = alpha > -VALUE_INFINITE || beta < VALUE_INFINITE
+            ? do_evaluate<false, true>(pos, alpha - Tempo, beta - Tempo, lazy) + Tempo
+            : do_evaluate<false, false>(pos, alpha, beta, lazy) + Tempo;
+#else
+    Value v = do_evaluate<false, false>(pos, alpha, beta, lazy) + Tempo;
+#endif
+
+    if (e && !lazy)
+    {
+        e->key32 = key32;
+        e->value = v;
+    }
+
+    if (lazyExit)
+        *lazyExit = lazy;
+
+    return v;
+  }
+
+
+  /// Table::resize() sets the size of the evaluation cache to the largest power
+  /// of 2 number of entries fitting in the given MB, and clears it. A size of
+  /// zero frees the table.
+
+  void Table::resize(size_t mbSize) {
+
+    size_t newSize = mbSize ? size_t(1) << msb((mbSize * 1024 * 1024) / sizeof(HashEntry)) : 0;
+
+    if (newSize == table.size())
+        return;
 
-  Value evaluate(const Position& pos) {
-    return do_evaluate<false>(pos) + Tempo;
+    std::vector<HashEntry>().swap(table);
+    table.resize(newSize, HashEntry());
+    probes = hits = 0;
   }
 
 
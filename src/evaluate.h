@@ -20,6 +20,8 @@
 #ifndef EVALUATE_H_INCLUDED
 #define EVALUATE_H_INCLUDED
 
+#include <vector>
+
 #include "types.h"
 
 class Position;
@@ -28,8 +30,42 @@ namespace Eval {
 
 const Value Tempo = Value(17); // Must be visible to search
 
+/// Eval::Table is the per-thread cache of the static evaluations, indexed by
+/// the position key. Each entry keeps the upper 32 bits of the key to detect
+/// the positions sharing the same slot. With nodestats=yes in the Makefile the
+/// probes and hits are counted to measure the hit rate in bench. An empty
+/// table disables the cache.
+
+struct HashEntry {
+  uint32_t key32;
+  int32_t value;
+};
+
+struct Table {
+
+  Table() : probes(0), hits(0) {}
+  void resize(size_t mbSize);
+  HashEntry* operator[](Key k) { return &table[(size_t)k & (table.size() - 1)]; }
+
+  std::vector<HashEntry> table;
+  uint64_t probes, hits;
+};
+
+/// Eval::Stats counts the evaluations of a thread, and how many of them took a
+/// lazy exit at each stage: after material and pawns, or after the pieces. Like
+/// the probes of the cache it is counted only with nodestats=yes.
+
+enum LazyStage { LAZY_MATERIAL, LAZY_PIECES, LAZY_STAGE_NB };
+
+struct Stats {
+  Stats() : calls(0) { lazy[LAZY_MATERIAL] = lazy[LAZY_PIECES] = 0; }
+
+  uint64_t calls, lazy[LAZY_STAGE_NB];
+};
+
 extern void init();
-extern Value evaluate(const Position& pos);
+extern Value evaluate(const Position& pos, Value alpha = -VALUE_INFINITE, Value beta = VALUE_INFINITE,
+                      bool* lazy = NULL);
 extern std::string trace(const Position& pos);
 
 }
@@ -0,0 +1,68 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2014 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <iomanip>
+#include <iostream>
+
+#include "bitboard.h"
+#include "tables.h"
+
+using namespace std;
+
+namespace {
+
+  // print() writes the definition of an array of unsigned integers
+  template<typename T>
+  void print(const char* decl, const T* values, size_t size, int width) {
+
+    cout << "\n" << decl << " = {" << hex << setfill('0');
+
+    for (size_t i = 0; i < size; ++i)
+        cout << (i % (256 / width) ? " " : "\n  ")
+             << "0x" << setw(width / 4) << uint64_t(values[i])
+             << (width == 64 ? "ULL" : "") << (i + 1 < size ? "," : "");
+
+    cout << dec << "\n};\n";
+  }
+
+}
+
+
+/// gentables is run by the Makefile to write tables.cpp. It is linked with the
+/// empty tables of notables.cpp, so that the tables are computed as usual at
+/// startup, and then prints them as C++ definitions.
+
+int main() {
+
+  Bitboards::init(true); // The magics are needed on the CPUs without pext
+  Bitbases::init_kpk();
+
+  cout << "// Generated by gentables, do not edit\n\n"
+       << "#include \"tables.h\"\n\n"
+       << "namespace Tables {\n\n"
+       << "const bool Precomputed = true;\n";
+
+  print("const Bitboard RookMagics[SQUARE_NB]", RMagics, SQUARE_NB, 64);
+  print("const Bitboard BishopMagics[SQUARE_NB]", BMagics, SQUARE_NB, 64);
+  print("const uint32_t KPKBitbase[KPKBitbaseSize]", Bitbases::kpk_bitbase(), Tables::KPKBitbaseSize, 32);
+
+  cout << "\n}" << endl;
+
+  return 0;
+}
@@ -20,28 +20,52 @@
 #include <iostream>
 
 #include "bitboard.h"
+#include "engine.h"
 #include "evaluate.h"
 #include "position.h"
 #include "search.h"
-#include "thread.h"
-#include "tt.h"
+#include "tables.h"
 #include "ucioption.h"
 
+namespace {
+
+  // In debug mode the time spent in each startup step is printed, to keep an
+  // eye on the startup cost.
+  void timed(const char* step, int64_t& last) {
+
+#ifndef NDEBUG
+    int64_t now = system_time_to_usec();
+    sync_cout << "info string " << step << " " << now - last << " us" << sync_endl;
+    last = now;
+#else
+    (void)step, (void)last;
+#endif
+  }
+
+} // namespace
+
+
 int main(int argc, char* argv[]) {
 
+  int64_t startup = system_time_to_usec(), last = startup;
+
+  UCI::init(Options);    timed("UCI::init", last);
+  Bitboards::init();     timed("Bitboards::init", last);
+  Position::init();      timed("Position::init", last);
+  Search::init();        timed("Search::init", last);
+  Pawns::init();         timed("Pawns::init", last);
+  Eval::init();          timed("Eval::init", last);
+  UCIEngine.init(Options["Threads"], Options["Hash"]);
+  timed("Engine::init", last);
+
+  // Printed after Bitboards::init(), which detects the CPU features it lists
   std::cout << engine_info() << std::endl;
 
-  UCI::init(Options);
-  Bitboards::init();
-  Position::init();
-  Bitbases::init_kpk();
-  Search::init();
-  Pawns::init();
-  Eval::init();
-  Threads.init();
-  TT.resize(Options["Hash"]);
+  // The KPK bitbase and the endgame maps are set up at their first use
+  last = startup;
+  timed(Tables::Precomputed ? "startup" : "startup, tables computed at startup", last);
 
   UCI::loop(argc, argv);
 
-  Threads.exit();
+  UCIEngine.exit();
 }
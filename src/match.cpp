@@ -0,0 +1,556 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2014 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stack>
+#include <string>
+#include <vector>
+
+#include "engine.h"
+#include "evaluate.h"
+#include "movegen.h"
+#include "rkiss.h"
+#include "ucioption.h"
+
+using namespace std;
+
+/// TrainingRecord is the 40 bytes record written by gensfen: the position, the
+/// score of the search and the static evaluation in internal units from the
+/// side to move point of view, the best move and the game result from the side
+/// to move point of view (1 win, 0 draw, -1 loss). Native byte order.
+
+struct TrainingRecord {
+  PackedPosition pos;
+  int16_t score, eval;
+  uint16_t move;
+  int8_t result;
+  uint8_t padding;
+};
+
+namespace {
+
+  // FEN string of the initial position, normal chess
+  const char* StartFEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+  // The match settings and the running score, shared by all the workers
+  struct Match {
+    Mutex mutex;
+    vector<string> openings;
+    int time, inc, games, started;
+    int wins, draws, losses, timeLosses; // From the first engine point of view
+    uint64_t nodes;
+  };
+
+  // A worker plays one game at a time between its two engines, each one with
+  // a single search thread, its own hash and time manager.
+  struct Worker {
+    Engine engines[2];
+    NativeHandle handle;
+    Match* match;
+  };
+
+
+  // no_output() is the PV hook of the engines, it silences the search output
+
+  void no_output(const Engine&, int, Value, Value) {}
+
+
+  // game_over() checks whether the game is ended by the rules, in which case it
+  // sets the result from white point of view and the reason. 'keys' holds the
+  // keys of the positions since the last capture or pawn move, current included.
+
+  bool game_over(const Position& pos, const vector<Key>& keys, int& result, string& reason) {
+
+    result = 0;
+
+    if (!MoveList<LEGAL>(pos).size())
+    {
+        reason = pos.checkers() ? "mate" : "stalemate";
+        result = !pos.checkers() ? 0 : pos.side_to_move() == WHITE ? -1 : 1;
+    }
+    else if (std::count(keys.begin(), keys.end(), pos.key()) >= 3)
+        reason = "repetition";
+
+    else if (keys.size() > 100)
+        reason = "50 moves rule";
+
+    else if (   !pos.pieces(PAWN)
+             && pos.non_pawn_material(WHITE) <= BishopValueMg
+             && pos.non_pawn_material(BLACK) <= BishopValueMg)
+        reason = "insufficient material";
+
+    else
+        return false;
+
+    return true;
+  }
+
+
+  // play_move() plays a move of the game, keeping the history needed to detect
+  // repetitions.
+
+  void play_move(Position& pos, Move m, std::stack<StateInfo>& states, vector<Key>& keys) {
+
+    if (pos.capture(m) || type_of(pos.moved_piece(m)) == PAWN)
+        keys.clear();
+
+    states.push(StateInfo());
+    pos.do_move(m, states.top());
+    keys.push_back(pos.key());
+  }
+
+
+  // play_game() plays a game from the given position, the first engine having
+  // the color 'first'. Returns the result from white point of view: 1 if white
+  // wins, 0 if draw and -1 if black wins, and sets the reason of the result.
+
+  int play_game(Worker& w, const string& fen, Color first, string& reason, uint64_t& nodes) {
+
+    Match& m = *w.match;
+    Search::StateStackPtr noStates; // Keep our own game history
+    std::stack<StateInfo> states;
+    Position pos(fen, Options["UCI_Chess960"], w.engines[0].threads.main());
+    vector<Key> keys(1, pos.key()); // Since last capture or pawn move
+    int time[COLOR_NB] = { m.time, m.time };
+    int result;
+
+    w.engines[0].tt.clear();
+    w.engines[1].tt.clear();
+
+    while (!game_over(pos, keys, result, reason))
+    {
+        Color us = pos.side_to_move();
+        Engine& e = w.engines[us != first];
+        Search::LimitsType limits;
+
+        limits.time[WHITE] = time[WHITE];
+        limits.time[BLACK] = time[BLACK];
+        limits.inc[WHITE] = limits.inc[BLACK] = m.inc;
+
+        Time::point start = Time::now();
+
+        e.threads.start_thinking(Position(pos, e.threads.main()), limits, noStates);
+        e.threads.wait_for_think_finished();
+
+        if ((time[us] -= int(Time::now() - start)) < 0)
+        {
+            reason = "time forfeit";
+            return us == WHITE ? -1 : 1;
+        }
+
+        time[us] += m.inc;
+        nodes += e.rootPos.nodes_searched();
+
+        play_move(pos, e.rootMoves[0].pv[0], states, keys);
+    }
+
+    return result;
+  }
+
+
+  // play_games() is the loop of the worker threads. Each opening is played
+  // twice in a row, with the first engine as white and then as black.
+
+  extern "C" long play_games(Worker* w) {
+
+    Match& m = *w->match;
+    string reason;
+    uint64_t nodes = 0;
+
+    while (true)
+    {
+        m.mutex.lock();
+        int n = m.started < m.games ? m.started++ : -1;
+        m.mutex.unlock();
+
+        if (n < 0)
+            break;
+
+        Color first = n % 2 ? BLACK : WHITE;
+        const string& fen = m.openings[(n / 2) % m.openings.size()];
+        int result = play_game(*w, fen, first, reason, nodes);
+        int score = first == WHITE ? result : -result;
+
+        m.mutex.lock();
+
+        m.wins   += score > 0;
+        m.draws  += score == 0;
+        m.losses += score < 0;
+        m.timeLosses += reason == "time forfeit";
+
+        sync_cout << "Game " << n + 1 << ": "
+                  << (result > 0 ? "1-0" : result < 0 ? "0-1" : "1/2-1/2")
+                  << " {" << reason << "} first engine is "
+                  << (first == WHITE ? "white" : "black") << ", score "
+                  << m.wins << "-" << m.losses << "-" << m.draws << sync_endl;
+
+        m.mutex.unlock();
+    }
+
+    m.mutex.lock();
+    m.nodes += nodes;
+    m.mutex.unlock();
+
+    return 0;
+  }
+
+
+  // Number of random moves played at the start of a gensfen game, for variety,
+  // and length after which the game is adjudicated a draw.
+  const int RandomPlies = 8;
+  const int MaxGamePly = 400;
+
+  // Size of the table of the keys of the positions already recorded
+  const size_t DedupSize = 1 << 22;
+
+  // The records of the finished games waiting for the writer thread, and the
+  // statistics of the generation, shared by all the gensfen workers.
+  struct Generator {
+    Mutex mutex;
+    ConditionVariable sleepCondition;
+    vector<TrainingRecord> queue;
+    bool done;
+    ofstream file;
+    Search::LimitsType limits;
+    uint64_t target, generated, written, duplicates, games;
+    vector<Key> recorded;
+  };
+
+  // A gensfen worker plays self-play games with its own single thread engine
+  struct GenWorker {
+    Engine engine;
+    NativeHandle handle;
+    Generator* gen;
+    RKISS rk;
+    uint64_t duplicates;
+  };
+
+
+  // generate_records() is the loop of the gensfen workers. Positions in check
+  // are not recorded, and neither those already recorded by any worker, that
+  // are detected through a table indexed by the position key. The table is not
+  // locked because a wrong read just keeps a duplicate or drops a position.
+
+  extern "C" long generate_records(GenWorker* w) {
+
+    Generator& g = *w->gen;
+    Engine& e = w->engine;
+    vector<TrainingRecord> records;
+    string reason;
+    int result;
+
+    while (true)
+    {
+        g.mutex.lock();
+        bool enough = g.generated >= g.target;
+        g.mutex.unlock();
+
+        if (enough)
+            break;
+
+        std::stack<StateInfo> states;
+        Search::StateStackPtr noStates;
+        Position pos(StartFEN, false, e.threads.main());
+        vector<Key> keys(1, pos.key());
+
+        records.clear();
+        e.tt.clear();
+
+        for (int ply = 0; !game_over(pos, keys, result, reason); ++ply)
+        {
+            if (ply < RandomPlies)
+            {
+                MoveList<LEGAL> it(pos);
+
+                for (size_t i = w->rk.rand<unsigned>() % it.size(); i > 0; --i)
+                    ++it;
+
+                play_move(pos, *it, states, keys);
+                continue;
+            }
+
+            if (ply >= MaxGamePly)
+                break;
+
+            e.threads.start_thinking(Position(pos, e.threads.main()), g.limits, noStates);
+            e.threads.wait_for_think_finished();
+
+            Value v = e.rootMoves[0].score;
+            Move best = e.rootMoves[0].pv[0];
+
+            if (abs(v) >= VALUE_KNOWN_WIN) // Adjudicate as won
+            {
+                result = (v > 0) == (pos.side_to_move() == WHITE) ? 1 : -1;
+                break;
+            }
+
+            Key& k = g.recorded[pos.key() & (DedupSize - 1)];
+
+            if (k == pos.key())
+                ++w->duplicates;
+
+            else if (!pos.checkers())
+            {
+                TrainingRecord r;
+
+                k = pos.key();
+                r.pos = pos.packed();
+                r.score = int16_t(v);
+                r.eval = int16_t(Eval::evaluate(pos));
+                r.move = uint16_t(best);
+                r.result = 0;
+                r.padding = 0;
+                records.push_back(r);
+            }
+
+            play_move(pos, best, states, keys);
+        }
+
+        for (size_t i = 0; i < records.size(); ++i)
+            records[i].result = int8_t(records[i].pos.sideToMove == WHITE ? result : -result);
+
+        g.mutex.lock();
+
+        g.queue.insert(g.queue.end(), records.begin(), records.end());
+        g.generated += records.size();
+        g.games++;
+        g.sleepCondition.notify_one();
+
+        g.mutex.unlock();
+    }
+
+    return 0;
+  }
+
+
+  // write_records() is the loop of the gensfen writer thread, so that the
+  // workers never wait for the disk.
+
+  extern "C" long write_records(Generator* g) {
+
+    vector<TrainingRecord> records;
+
+    g->mutex.lock();
+
+    while (true)
+    {
+        while (g->queue.empty() && !g->done)
+            g->sleepCondition.wait(g->mutex);
+
+        if (g->queue.empty())
+            break;
+
+        records.swap(g->queue);
+        g->mutex.unlock();
+
+        g->file.write((const char*)&records[0], records.size() * sizeof(TrainingRecord));
+        g->written += records.size();
+        records.clear();
+
+        g->mutex.lock();
+    }
+
+    g->mutex.unlock();
+
+    return 0;
+  }
+
+} // namespace
+
+
+/// match() plays games between two engines in this process, so that many
+/// games can run concurrently without the cost of a process per engine and of
+/// the UCI protocol. The parameters are the number of games (default 100), the
+/// number of concurrent games (default is the "Threads" option), the time on
+/// the clock and the increment per move in msec (default 10000 and 100), a
+/// file of opening positions in FEN or EPD format ('none' for the start
+/// position) and the hash size of each engine in MB (default 16). The engines
+/// are the same program with the same UCI options, so the match measures the
+/// self-play throughput and tests the time management under load. The score
+/// is reported as wins, losses and draws of the first engine.
+
+void match(istream& is) {
+
+  string token;
+  Match m;
+
+  m.games     = (is >> token) ? atoi(token.c_str()) : 100;
+  int workers = (is >> token) ? atoi(token.c_str()) : int(Options["Threads"]);
+  m.time      = (is >> token) ? atoi(token.c_str()) : 10000;
+  m.inc       = (is >> token) ? atoi(token.c_str()) : 100;
+  string file = (is >> token) ? token : "none";
+  int hash    = (is >> token) ? atoi(token.c_str()) : 16;
+
+  m.started = m.wins = m.draws = m.losses = m.timeLosses = 0;
+  m.nodes = 0;
+
+  if (file != "none")
+  {
+      string fen;
+      ifstream f(file.c_str());
+
+      if (!f.is_open())
+      {
+          cerr << "Unable to open file " << file << endl;
+          return;
+      }
+
+      while (getline(f, fen))
+          if (fen.find_first_not_of(" \t\r") != string::npos)
+              m.openings.push_back(fen);
+  }
+
+  if (m.openings.empty())
+      m.openings.push_back(StartFEN);
+
+  workers = std::min(std::max(workers, 1), std::min(MAX_THREADS, m.games));
+  vector<Worker*> pool;
+  Time::point elapsed = Time::now();
+
+  for (int i = 0; i < workers; ++i)
+  {
+      Worker* w = new Worker;
+
+      for (int j = 0; j < 2; ++j)
+      {
+          w->engines[j].init(1, std::max(hash, 1));
+          w->engines[j].onPv = no_output;
+      }
+
+      w->match = &m;
+
+      thread_create(w->handle, play_games, w);
+      pool.push_back(w);
+  }
+
+  for (size_t i = 0; i < pool.size(); ++i)
+  {
+      thread_join(pool[i]->handle);
+
+      pool[i]->engines[0].exit();
+      pool[i]->engines[1].exit();
+      delete pool[i];
+  }
+
+  elapsed = std::max(Time::now() - elapsed, Time::point(1));
+  int games = m.wins + m.draws + m.losses;
+
+  cerr << "\n==========================="
+       << "\nGames           : " << games
+       << "\nConcurrent games: " << workers
+       << "\nScore (W-L-D)   : " << m.wins << "-" << m.losses << "-" << m.draws
+       << " (" << (games ? 100.0 * (m.wins + 0.5 * m.draws) / games : 0.0) << "%)"
+       << "\nTime forfeits   : " << m.timeLosses
+       << "\nTotal time (ms) : " << elapsed
+       << "\nGames/hour      : " << 3600000LL * games / elapsed
+       << "\nNodes searched  : " << m.nodes
+       << "\nNodes/second    : " << 1000 * m.nodes / elapsed << endl;
+}
+
+
+/// gensfen() generates training data for the evaluation: it plays self-play
+/// games at a fixed depth or number of nodes from the start position after a
+/// few random moves, and writes the positions with the search score, the static
+/// evaluation, the best move and the game result as TrainingRecord records.
+/// The parameters are the number of positions (default 100000), the number of
+/// workers (default is the "Threads" option), the limit value and type ('depth'
+/// or 'nodes', default is depth 8), the output file (default "train.bin") and
+/// the hash size of each worker in MB (default 16). Positions are deduplicated
+/// by key across all the games.
+
+void gensfen(istream& is) {
+
+  string token;
+  Generator g;
+
+  g.target         = (is >> token) ? atoi(token.c_str()) : 100000;
+  int workers      = (is >> token) ? atoi(token.c_str()) : int(Options["Threads"]);
+  int limit        = (is >> token) ? atoi(token.c_str()) : 8;
+  string limitType = (is >> token) ? token : "depth";
+  string fileName  = (is >> token) ? token : "train.bin";
+  int hash         = (is >> token) ? atoi(token.c_str()) : 16;
+
+  if (limitType == "nodes")
+      g.limits.nodes = limit;
+  else
+      g.limits.depth = limit;
+
+  g.file.open(fileName.c_str(), ios::binary | ios::app);
+
+  if (!g.file.is_open())
+  {
+      cerr << "Unable to open file " << fileName << endl;
+      return;
+  }
+
+  g.done = false;
+  g.generated = g.written = g.duplicates = g.games = 0;
+  g.recorded.assign(DedupSize, 0);
+
+  workers = std::min(std::max(workers, 1), MAX_THREADS);
+  vector<GenWorker*> pool;
+  NativeHandle writer;
+  Time::point elapsed = Time::now();
+
+  thread_create(writer, write_records, &g);
+
+  for (int i = 0; i < workers; ++i)
+  {
+      GenWorker* w = new GenWorker;
+
+      w->engine.init(1, std::max(hash, 1));
+      w->engine.onPv = no_output;
+      w->gen = &g;
+      w->rk = RKISS(int(Time::now() % 1000) + 100 * i); // Different games per worker
+      w->duplicates = 0;
+
+      thread_create(w->handle, generate_records, w);
+      pool.push_back(w);
+  }
+
+  for (size_t i = 0; i < pool.size(); ++i)
+  {
+      thread_join(pool[i]->handle);
+
+      g.duplicates += pool[i]->duplicates;
+
+      pool[i]->engine.exit();
+      delete pool[i];
+  }
+
+  g.mutex.lock();
+  g.done = true;
+  g.sleepCondition.notify_one();
+  g.mutex.unlock();
+
+  thread_join(writer);
+
+  elapsed = std::max(Time::now() - elapsed, Time::point(1));
+
+  cerr << "\n==========================="
+       << "\nWorkers         : " << workers
+       << "\nGames           : " << g.games
+       << "\nPositions       : " << g.written
+       << "\nDuplicates      : " << g.duplicates
+       << "\nTotal time (ms) : " << elapsed
+       << "\nPositions/second: " << 1000 * g.written / elapsed << endl;
+}
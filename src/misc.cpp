@@ -53,6 +53,8 @@ const string engine_info(bool to_uci) {
 
   ss << (Is64Bit ? " 64" : "")
      << (HasPext ? " BMI2" : (HasPopCnt ? " SSE4.2" : ""))
+     << (HasAvx2 ? " AVX2" : "")
+     << (HasDispatch ? " (dispatch)" : "")
      << (to_uci  ? "\nid author ": " by ")
      << "Tord Romstad, Marco Costalba and Joona Kiiski";
 
@@ -407,6 +407,13 @@ ExtMove* generate<LEGAL>(const Position& pos, ExtMove* mlist) {
 
   end = pos.checkers() ? generate<EVASIONS>(pos, mlist)
                        : generate<NON_EVASIONS>(pos, mlist);
+
+  // When not in check and without pins and en passant captures, only the king
+  // moves can be illegal. generate_all() emits them, castling included, after
+  // the other pieces, so test only this tail of the list.
+  if (!pos.checkers() && !pinned && pos.ep_square() == SQ_NONE)
+      for (cur = end; cur != mlist && from_sq((cur - 1)->move) == ksq; --cur) {}
+
   while (cur != end)
       if (   (pinned || from_sq(cur->move) == ksq || type_of(cur->move) == ENPASSANT)
           && !pos.legal(cur->move, pinned))
@@ -49,6 +49,11 @@ namespace {
     }
   }
 
+  // Number of quiet moves with a negative history picked one at a time before
+  // sorting the remaining ones. Cut nodes try less than five moves on average,
+  // see Search::NodeStats, so most of them never pay for the full sort.
+  const int LazyPicks = 3;
+
   // Unary predicate used by std::partition to split positive values from remaining
   // ones so as to sort the two sets separately, with the second sort delayed.
   inline bool has_positive_value(const ExtMove& ms) { return ms.value > 0; }
@@ -61,6 +66,17 @@ namespace {
       std::swap(*begin, *std::max_element(begin, end));
       return begin;
   }
+
+  // Like pick_best() but shifts the moves in front of the best one instead of
+  // swapping, so that the moves come in the same order as with insertion_sort().
+  inline void pick_stable(ExtMove* begin, ExtMove* end)
+  {
+      ExtMove* best = std::max_element(begin, end);
+      ExtMove tmp = *best;
+
+      std::copy_backward(begin, best, best + 1);
+      *begin = tmp;
+  }
 }
 
 
@@ -68,10 +84,11 @@ namespace {
 /// to help it to return the (presumably) good moves first, to decide which
 /// moves to return (in the quiescence search, for instance, we only want to
 /// search captures, promotions and some checks) and how important good move
-/// ordering is at the current node.
+/// ordering is at the current node. The moves are generated in the given list,
+/// of MAX_MOVES entries, that must outlive the MovePicker.
 
-MovePicker::MovePicker(const Position& p, Move ttm, Depth d, const HistoryStats& h,
-                       Move* cm, Move* fm, Search::Stack* s) : pos(p), history(h), depth(d) {
+MovePicker::MovePicker(const Position& p, ExtMove* ml, Move ttm, Depth d, const HistoryStats& h,
+                       Move* cm, Move* fm, Search::Stack* s) : pos(p), history(h), depth(d), moves(ml) {
 
   assert(d > DEPTH_ZERO);
 
@@ -91,8 +108,8 @@ MovePicker::MovePicker(const Position& p, Move ttm, Depth d, const HistoryStats&
   end += (ttMove != MOVE_NONE);
 }
 
-MovePicker::MovePicker(const Position& p, Move ttm, Depth d, const HistoryStats& h,
-                       Square s) : pos(p), history(h), cur(moves), end(moves) {
+MovePicker::MovePicker(const Position& p, ExtMove* ml, Move ttm, Depth d, const HistoryStats& h,
+                       Square s) : pos(p), history(h), cur(ml), end(ml), moves(ml) {
 
   assert(d <= DEPTH_ZERO);
 
@@ -123,8 +140,8 @@ MovePicker::MovePicker(const Position& p, Move ttm, Depth d, const HistoryStats&
   end += (ttMove != MOVE_NONE);
 }
 
-MovePicker::MovePicker(const Position& p, Move ttm, const HistoryStats& h, PieceType pt)
-                       : pos(p), history(h), cur(moves), end(moves) {
+MovePicker::MovePicker(const Position& p, ExtMove* ml, Move ttm, const HistoryStats& h, PieceType pt)
+                       : pos(p), history(h), cur(ml), end(ml), moves(ml) {
 
   assert(!pos.checkers());
 
@@ -135,7 +152,7 @@ MovePicker::MovePicker(const Position& p, Move ttm, const HistoryStats& h, Piece
   captureThreshold = PieceValue[MG][pt];
   ttMove = (ttm && pos.pseudo_legal(ttm) ? ttm : MOVE_NONE);
 
-  if (ttMove && (!pos.capture(ttMove) || pos.see(ttMove) <= captureThreshold))
+  if (ttMove && (!pos.capture(ttMove) || !pos.see_ge(ttMove, captureThreshold + 1)))
       ttMove = MOVE_NONE;
 
   end += (ttMove != MOVE_NONE);
@@ -192,6 +209,7 @@ void MovePicker::score<EVASIONS>() {
   // Try good captures ordered by MVV/LVA, then non-captures if destination square
   // is not under attack, ordered by history value, then bad-captures and quiet
   // moves with a negative SEE. This last group is ordered by the SEE value.
+  // So the value is below -HistoryStats::Max exactly when the SEE is negative.
   Move m;
   Value see;
 
@@ -256,13 +274,14 @@ void MovePicker::generate_next_stage() {
       score<QUIETS>();
       end = std::partition(cur, end, has_positive_value);
       insertion_sort(cur, end);
+      sorted = end;
       return;
 
   case QUIETS_2_S1:
       cur = end;
       end = endQuiets;
-      if (depth >= 3 * ONE_PLY)
-          insertion_sort(cur, end);
+      sorted = depth >= 3 * ONE_PLY ? cur : end;
+      picks = 0;
       return;
 
   case BAD_CAPTURES_S1:
@@ -298,11 +317,21 @@ void MovePicker::generate_next_stage() {
 /// next_move() is the most important method of the MovePicker class. It returns
 /// a new pseudo legal move every time it is called, until there are no more moves
 /// left. It picks the move with the biggest value from a list of generated moves
-/// taking care not to return the ttMove if it has already been searched.
+/// taking care not to return the ttMove if it has already been searched. When
+/// 'see' is given it receives a value with the sign of the SEE of the move, if
+/// already computed by the MovePicker, or VALUE_NONE, so that the SEE of each
+/// move is computed at most once.
 template<>
-Move MovePicker::next_move<false>() {
+Move MovePicker::next_move<false>(Value* see) {
 
   Move move;
+  ExtMove* best;
+  Value unused;
+
+  if (!see)
+      see = &unused;
+
+  *see = VALUE_NONE;
 
   while (true)
   {
@@ -319,8 +348,11 @@ Move MovePicker::next_move<false>() {
           move = pick_best(cur++, end)->move;
           if (move != ttMove)
           {
-              if (pos.see_sign(move) >= VALUE_ZERO)
+              if (pos.see_ge(move, VALUE_ZERO))
+              {
+                  *see = VALUE_KNOWN_WIN;
                   return move;
+              }
 
               // Losing capture, move it to the tail of the array
               (endBadCaptures--)->move = move;
@@ -337,6 +369,21 @@ Move MovePicker::next_move<false>() {
           break;
 
       case QUIETS_1_S1: case QUIETS_2_S1:
+          // Sort lazily, most nodes need only the first moves
+          if (cur == sorted)
+          {
+              if (++picks <= LazyPicks)
+              {
+                  pick_stable(cur, end);
+                  sorted = cur + 1;
+              }
+              else
+              {
+                  insertion_sort(cur, end);
+                  sorted = end;
+              }
+          }
+
           move = (cur++)->move;
           if (   move != ttMove
               && move != killers[0].move
@@ -349,9 +396,22 @@ Move MovePicker::next_move<false>() {
           break;
 
       case BAD_CAPTURES_S1:
+          *see = -VALUE_KNOWN_WIN; // All of them failed the SEE test
           return (cur--)->move;
 
-      case EVASIONS_S2: case CAPTURES_S3: case CAPTURES_S4:
+      case EVASIONS_S2:
+          best = pick_best(cur++, end);
+          move = best->move;
+
+          // A single evasion is not scored, see generate_next_stage()
+          if (end > moves + 1)
+              *see = best->value < -HistoryStats::Max ? -VALUE_KNOWN_WIN : VALUE_KNOWN_WIN;
+
+          if (move != ttMove)
+              return move;
+          break;
+
+      case CAPTURES_S3: case CAPTURES_S4:
           move = pick_best(cur++, end)->move;
           if (move != ttMove)
               return move;
@@ -359,8 +419,11 @@ Move MovePicker::next_move<false>() {
 
       case CAPTURES_S5:
            move = pick_best(cur++, end)->move;
-           if (move != ttMove && pos.see(move) > captureThreshold)
+           if (move != ttMove && pos.see_ge(move, captureThreshold + 1))
+           {
+               *see = VALUE_KNOWN_WIN;
                return move;
+           }
            break;
 
       case CAPTURES_S6:
@@ -389,4 +452,4 @@ Move MovePicker::next_move<false>() {
 /// from the split point's shared MovePicker object. This function is not thread
 /// safe so must be lock protected by the caller.
 template<>
-Move MovePicker::next_move<true>() { return ss->splitPoint->movePicker->next_move<false>(); }
+Move MovePicker::next_move<true>(Value* see) { return ss->splitPoint->movePicker->next_move<false>(see); }
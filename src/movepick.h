@@ -84,11 +84,11 @@ class MovePicker {
   MovePicker& operator=(const MovePicker&); // Silence a warning under MSVC
 
 public:
-  MovePicker(const Position&, Move, Depth, const HistoryStats&, Square);
-  MovePicker(const Position&, Move, const HistoryStats&, PieceType);
-  MovePicker(const Position&, Move, Depth, const HistoryStats&, Move*, Move*, Search::Stack*);
+  MovePicker(const Position&, ExtMove*, Move, Depth, const HistoryStats&, Square);
+  MovePicker(const Position&, ExtMove*, Move, const HistoryStats&, PieceType);
+  MovePicker(const Position&, ExtMove*, Move, Depth, const HistoryStats&, Move*, Move*, Search::Stack*);
 
-  template<bool SpNode> Move next_move();
+  template<bool SpNode> Move next_move(Value* see = NULL);
 
 private:
   template<GenType> void score();
@@ -104,9 +104,9 @@ private:
   ExtMove killers[6];
   Square recaptureSquare;
   Value captureThreshold;
-  int stage;
-  ExtMove *cur, *end, *endQuiets, *endBadCaptures;
-  ExtMove moves[MAX_MOVES];
+  int stage, picks;
+  ExtMove *cur, *end, *endQuiets, *endBadCaptures, *sorted;
+  ExtMove* moves; // MAX_MOVES entries owned by the caller, see Thread::moveLists
 };
 
 #endif // #ifndef MOVEPICK_H_INCLUDED
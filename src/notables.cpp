@@ -0,0 +1,32 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2014 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "tables.h"
+
+/// Empty tables for builds without the gentables step, for instance when
+/// cross compiling. The tables are then computed at startup.
+
+namespace Tables {
+
+const bool Precomputed = false;
+const Bitboard RookMagics[SQUARE_NB] = { 0 };
+const Bitboard BishopMagics[SQUARE_NB] = { 0 };
+const uint32_t KPKBitbase[KPKBitbaseSize] = { 0 };
+
+}
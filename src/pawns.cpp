@@ -296,11 +296,12 @@ Score Entry::do_king_safety(const Position& pos, Square ksq) {
 
   kingSquares[Us] = ksq;
   castlingRights[Us] = pos.can_castle(Us);
-  minKPdistance[Us] = 0;
 
   Bitboard pawns = pos.pieces(Us, PAWN);
-  if (pawns)
-      while (!(DistanceRingsBB[ksq][minKPdistance[Us]++] & pawns)) {}
+  minKPdistance[Us] = pawns ? 8 : 0;
+
+  while (pawns)
+      minKPdistance[Us] = std::min(minKPdistance[Us], square_distance(ksq, pop_lsb(&pawns)));
 
   if (relative_rank(Us, ksq) > RANK_4)
       return make_score(0, -16 * minKPdistance[Us]);
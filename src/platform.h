@@ -52,6 +52,12 @@ inline int64_t system_time_to_msec() {
   return t.tv_sec * 1000LL + t.tv_usec / 1000;
 }
 
+inline int64_t system_time_to_usec() {
+  timeval t;
+  gettimeofday(&t, NULL);
+  return t.tv_sec * 1000000LL + t.tv_usec;
+}
+
 #  include <pthread.h>
 typedef pthread_mutex_t Lock;
 typedef pthread_cond_t WaitCondition;
@@ -80,6 +86,10 @@ inline int64_t system_time_to_msec() {
   return t.time * 1000LL + t.millitm;
 }
 
+inline int64_t system_time_to_usec() { // Only msec resolution
+  return system_time_to_msec() * 1000;
+}
+
 #ifndef NOMINMAX
 #  define NOMINMAX // disable macros min() and max()
 #endif
@@ -24,6 +24,7 @@
 #include <sstream>
 
 #include "bitcount.h"
+#include "engine.h"
 #include "movegen.h"
 #include "position.h"
 #include "psqtab.h"
@@ -301,12 +302,85 @@ void Position::set(const string& fenStr, bool isChess960, Thread* th) {
 
   chess960 = isChess960;
   thisThread = th;
+
+#ifdef USE_ATTACK_MAPS
+  update_attacks(pieces());
+#endif
+
+  set_state(st);
+
+  assert(pos_is_ok());
+}
+
+
+/// Position::set() initializes the position object with the given packed
+/// position. As with FEN strings the input is assumed to be correct.
+
+void Position::set(const PackedPosition& pp, bool isChess960, Thread* th) {
+
+  clear();
+
+  int idx = 0;
+
+  for (Bitboard b = pp.occupied; b; ++idx)
+  {
+      Square s = pop_lsb(&b);
+      Piece pc = Piece((pp.pieces[idx / 2] >> (4 * (idx & 1))) & 0xF);
+      put_piece(s, color_of(pc), type_of(pc));
+  }
+
+  sideToMove = Color(pp.sideToMove);
+
+  for (int i = 0; i < 4; ++i)
+      if (pp.castling & (1 << i))
+      {
+          Color c = Color(i / 2);
+          File f = File((pp.castling >> (4 + 3 * i)) & 7);
+          set_castling_right(c, make_square(f, relative_rank(c, RANK_1)));
+      }
+
+  st->epSquare = Square(pp.epSquare);
+  st->rule50 = pp.rule50;
+  gamePly = pp.gamePly;
+  chess960 = isChess960;
+  thisThread = th;
+
+#ifdef USE_ATTACK_MAPS
+  update_attacks(pieces());
+#endif
+
   set_state(st);
 
   assert(pos_is_ok());
 }
 
 
+/// Position::packed() returns the packed representation of the position
+
+PackedPosition Position::packed() const {
+
+  PackedPosition pp;
+  int idx = 0;
+
+  std::memset(&pp, 0, sizeof(PackedPosition));
+  pp.occupied = pieces();
+
+  for (Bitboard b = pieces(); b; ++idx)
+      pp.pieces[idx / 2] |= uint8_t(piece_on(pop_lsb(&b)) << (4 * (idx & 1)));
+
+  for (int i = 0; i < 4; ++i)
+      if (can_castle(CastlingRight(1 << i)))
+          pp.castling |= uint16_t((1 << i) | (file_of(castlingRookSquare[1 << i]) << (4 + 3 * i)));
+
+  pp.gamePly = uint16_t(gamePly);
+  pp.sideToMove = uint8_t(sideToMove);
+  pp.epSquare = uint8_t(st->epSquare);
+  pp.rule50 = uint8_t(std::min(st->rule50, 255));
+
+  return pp;
+}
+
+
 /// Position::set_castling_right() is a helper function used to set castling
 /// rights given the corresponding color and the rook starting square.
 
@@ -731,6 +805,9 @@ void Position::do_move(Move m, StateInfo& newSt, const CheckInfo& ci, bool moveI
   Piece pc = piece_on(from);
   PieceType pt = type_of(pc);
   PieceType captured = type_of(m) == ENPASSANT ? PAWN : type_of(piece_on(to));
+#ifdef USE_ATTACK_MAPS
+  Bitboard occupied = pieces();
+#endif
 
   assert(color_of(pc) == us);
   assert(piece_on(to) == NO_PIECE || color_of(piece_on(to)) == them || type_of(m) == CASTLING);
@@ -808,7 +885,7 @@ void Position::do_move(Move m, StateInfo& newSt, const CheckInfo& ci, bool moveI
   }
 
   // Prefetch TT access as soon as we know the new hash key
-  prefetch((char*)TT.first_entry(k));
+  prefetch((char*)thisThread->engine->tt.first_entry(k));
 
   // Move the piece. The tricky Chess960 castling is handled earlier
   if (type_of(m) != CASTLING)
@@ -865,6 +942,10 @@ void Position::do_move(Move m, StateInfo& newSt, const CheckInfo& ci, bool moveI
   // Update the key with the final value
   st->key = k;
 
+#ifdef USE_ATTACK_MAPS
+  update_attacks((occupied ^ pieces()) | from | to);
+#endif
+
   // Update checkers bitboard: piece must be already moved due to attacks_from()
   st->checkersBB = 0;
 
@@ -909,6 +990,9 @@ void Position::undo_move(Move m) {
   Square from = from_sq(m);
   Square to = to_sq(m);
   PieceType pt = type_of(piece_on(to));
+#ifdef USE_ATTACK_MAPS
+  Bitboard occupied = pieces();
+#endif
 
   assert(empty(from) || type_of(m) == CASTLING);
   assert(st->capturedType != KING);
@@ -951,6 +1035,10 @@ void Position::undo_move(Move m) {
       }
   }
 
+#ifdef USE_ATTACK_MAPS
+  update_attacks((occupied ^ pieces()) | from | to);
+#endif
+
   // Finally point our state pointer back to the previous state
   st = st->previous;
   --gamePly;
@@ -959,6 +1047,38 @@ void Position::undo_move(Move m) {
 }
 
 
+#ifdef USE_ATTACK_MAPS
+
+/// Position::update_attacks() updates the attack maps after the pieces on the
+/// 'changed' squares have been placed, moved or removed. Besides the pieces on
+/// those squares, only the sliders whose rays stopped on one of them before the
+/// update can have different attacks, and the attackers of each square are
+/// kept in sync with the differences.
+
+void Position::update_attacks(Bitboard changed) {
+
+  Bitboard sliders = pieces(BISHOP, ROOK) | pieces(QUEEN);
+  Bitboard update = changed;
+
+  while (changed)
+      update |= squareAttackers[pop_lsb(&changed)] & sliders;
+
+  while (update)
+  {
+      Square s = pop_lsb(&update);
+      Bitboard b = empty(s) ? 0 : attacks_from(piece_on(s), s);
+      Bitboard diff = pieceAttacks[s] ^ b;
+
+      pieceAttacks[s] = b;
+
+      while (diff)
+          squareAttackers[pop_lsb(&diff)] ^= s;
+  }
+}
+
+#endif
+
+
 /// Position::do_castling() is a helper used to do/undo a castling move. This
 /// is a bit tricky, especially in Chess960.
 template<bool Do>
@@ -997,7 +1117,7 @@ void Position::do_null_move(StateInfo& newSt) {
   }
 
   st->key ^= Zobrist::side;
-  prefetch((char*)TT.first_entry(st->key));
+  prefetch((char*)thisThread->engine->tt.first_entry(st->key));
 
   ++st->rule50;
   st->pliesFromNull = 0;
@@ -1063,7 +1183,7 @@ Value Position::see(Move m) const {
 
   // Find all attackers to the destination square, with the moving piece
   // removed, but possibly an X-ray attacker added behind it.
-  attackers = attackers_to(to, occupied) & occupied;
+  attackers = exchange_attackers(to, occupied);
 
   // If the opponent has no attackers we are finished
   stm = ~stm;
@@ -1112,6 +1232,95 @@ Value Position::see(Move m) const {
 }
 
 
+/// Position::see_ge() tests if the SEE value of a move is greater or equal to
+/// the given threshold, as see(m) >= threshold. It plays the same exchange but
+/// keeps only the balance of the captures, and stops as soon as the side to
+/// move can neither drop below nor rise above the threshold, so that usually
+/// only the first captures are looked at.
+
+bool Position::see_ge(Move m, Value threshold) const {
+
+  assert(is_ok(m));
+
+  // See the comment in see() about castling moves
+  if (type_of(m) == CASTLING)
+      return VALUE_ZERO >= threshold;
+
+  Square from = from_sq(m), to = to_sq(m);
+  PieceType captured = type_of(piece_on(from));
+  Color stm = ~color_of(piece_on(from));
+  Bitboard occupied = pieces() ^ from;
+  Value balance = PieceValue[MG][piece_on(to)];
+
+  if (type_of(m) == ENPASSANT)
+  {
+      occupied ^= to + pawn_push(stm); // Remove the captured pawn
+      balance = PieceValue[MG][PAWN];
+  }
+
+  // Even if the capture is not answered we don't reach the threshold
+  if (balance < threshold)
+      return false;
+
+  // A king capture is answered only if illegal, see() returns the captured value
+  if (captured == KING)
+      return true;
+
+  // Even if our piece is lost for nothing we are still above the threshold
+  balance -= PieceValue[MG][captured];
+  if (balance >= threshold)
+      return true;
+
+  Bitboard attackers = exchange_attackers(to, occupied);
+  Bitboard stmAttackers;
+  bool opponentToMove = true;
+
+  // Now 'balance' is below the threshold if the opponent is to move and above
+  // it otherwise. The side to move captures only if this changes the verdict,
+  // else it stops and the exchange is decided.
+  while ((stmAttackers = attackers & pieces(stm)))
+  {
+      captured = min_attacker<PAWN>(byTypeBB, to, stmAttackers, occupied, attackers);
+
+      // A king capture is legal only if the other side has no attackers left
+      if (captured == KING)
+          return opponentToMove == bool(attackers & pieces(~stm));
+
+      balance += opponentToMove ? PieceValue[MG][captured] : -PieceValue[MG][captured];
+      opponentToMove = !opponentToMove;
+
+      if (opponentToMove == (balance >= threshold))
+          return opponentToMove;
+
+      stm = ~stm;
+  }
+
+  return opponentToMove;
+}
+
+
+/// Position::exchange_attackers() returns the attackers of a square once the
+/// moving piece is removed from 'occupied', with the X-ray attackers behind it.
+
+Bitboard Position::exchange_attackers(Square to, Bitboard occupied) const {
+
+#ifdef USE_ATTACK_MAPS
+  // The maps miss only the sliders behind the removed pieces, when aligned
+  Bitboard attackers = attackers_to(to);
+
+  if (PseudoAttacks[BISHOP][to] & (pieces() ^ occupied))
+      attackers |= attacks_bb<BISHOP>(to, occupied) & pieces(BISHOP, QUEEN);
+
+  if (PseudoAttacks[ROOK][to] & (pieces() ^ occupied))
+      attackers |= attacks_bb<ROOK>(to, occupied) & pieces(ROOK, QUEEN);
+
+  return attackers & occupied;
+#else
+  return attackers_to(to, occupied) & occupied;
+#endif
+}
+
+
 /// Position::is_draw() tests whether the position is drawn by material, 50 moves
 /// rule or repetition. It does not detect stalemates.
 
@@ -1186,6 +1395,9 @@ bool Position::pos_is_ok(int* step) const {
   const bool testPieceCounts     = all || false;
   const bool testPieceList       = all || false;
   const bool testCastlingSquares = all || false;
+#ifdef USE_ATTACK_MAPS
+  const bool testAttackMaps      = all || false;
+#endif
 
   if (step)
       *step = 1;
@@ -1265,5 +1477,13 @@ bool Position::pos_is_ok(int* step) const {
                   return false;
           }
 
+#ifdef USE_ATTACK_MAPS
+  if (step && ++*step, testAttackMaps)
+      for (Square s = SQ_A1; s <= SQ_H8; ++s)
+          if (   pieceAttacks[s] != (empty(s) ? 0 : attacks_from(piece_on(s), s))
+              || squareAttackers[s] != attackers_to(s, pieces()))
+              return false;
+#endif
+
   return true;
 }
@@ -62,6 +62,28 @@ struct StateInfo {
 };
 
 
+/// PackedPosition is a fixed size, 32 bytes, binary encoding of a position,
+/// faster to read and write than a FEN string. 'pieces' holds a 4 bit piece
+/// code for each occupied square, in the order of the 'occupied' bitboard bits
+/// and low nibble first. 'castling' holds the castling rights in bits 0-3 and
+/// the file of the corresponding rook in bits 4-15, 3 bits per right, so that
+/// Chess960 positions are encoded too. Fields are in native byte order.
+
+struct PackedPosition {
+  Bitboard occupied;
+  uint8_t pieces[16];
+  uint16_t castling;
+  uint16_t gamePly;
+  uint8_t sideToMove, epSquare, rule50, padding;
+};
+
+/// Files with the ".bin" extension hold packed positions instead of FEN strings
+inline bool is_packed_file(const std::string& fileName) {
+  return   fileName.size() > 4
+        && fileName.compare(fileName.size() - 4, 4, ".bin") == 0;
+}
+
+
 /// When making a move the current StateInfo up to 'key' excluded is copied to
 /// the new one. Here we calculate the quad words (64bits) needed to be copied.
 const size_t StateCopySize64 = offsetof(StateInfo, key) / sizeof(uint64_t) + 1;
@@ -83,6 +105,8 @@ public:
   // Text input/output
   void set(const std::string& fenStr, bool isChess960, Thread* th);
   const std::string fen() const;
+  void set(const PackedPosition& pp, bool isChess960, Thread* th);
+  PackedPosition packed() const;
   const std::string pretty() const;
 
   // Position representation
@@ -116,6 +140,7 @@ public:
   Bitboard attacks_from(Piece pc, Square s) const;
   template<PieceType> Bitboard attacks_from(Square s) const;
   template<PieceType> Bitboard attacks_from(Square s, Color c) const;
+  template<PieceType> Bitboard attacks_of(Square s) const;
 
   // Properties of moves
   bool legal(Move m, Bitboard pinned) const;
@@ -143,6 +168,7 @@ public:
   // Static exchange evaluation
   Value see(Move m) const;
   Value see_sign(Move m) const;
+  bool see_ge(Move m, Value threshold) const;
 
   // Accessing hash keys
   Key key() const;
@@ -176,11 +202,15 @@ private:
 
   // Helper functions
   Bitboard check_blockers(Color c, Color kingColor) const;
+  Bitboard exchange_attackers(Square to, Bitboard occupied) const;
   void put_piece(Square s, Color c, PieceType pt);
   void remove_piece(Square s, Color c, PieceType pt);
   void move_piece(Square from, Square to, Color c, PieceType pt);
   template<bool Do>
   void do_castling(Square from, Square& to, Square& rfrom, Square& rto);
+#ifdef USE_ATTACK_MAPS
+  void update_attacks(Bitboard changed);
+#endif
 
   // Board and pieces
   Piece board[SQUARE_NB];
@@ -190,6 +220,12 @@ private:
   Square pieceList[COLOR_NB][PIECE_TYPE_NB][16];
   int index[SQUARE_NB];
 
+#ifdef USE_ATTACK_MAPS
+  // Attacks of the piece on each square and attackers of each square
+  Bitboard pieceAttacks[SQUARE_NB];
+  Bitboard squareAttackers[SQUARE_NB];
+#endif
+
   // Other info
   int castlingRightsMask[SQUARE_NB];
   Square castlingRookSquare[CASTLING_RIGHT_NB];
@@ -300,8 +336,27 @@ inline Bitboard Position::attacks_from(Piece pc, Square s) const {
   return attacks_bb(pc, s, byTypeBB[ALL_PIECES]);
 }
 
+/// attacks_of() returns the attacks of the piece of type Pt, not a pawn, that
+/// stands on square s. With attack maps they are read from the maps.
+
+template<PieceType Pt>
+inline Bitboard Position::attacks_of(Square s) const {
+
+  assert(type_of(piece_on(s)) == Pt && Pt != PAWN);
+
+#ifdef USE_ATTACK_MAPS
+  return pieceAttacks[s];
+#else
+  return attacks_from<Pt>(s);
+#endif
+}
+
 inline Bitboard Position::attackers_to(Square s) const {
+#ifdef USE_ATTACK_MAPS
+  return squareAttackers[s];
+#else
   return attackers_to(s, byTypeBB[ALL_PIECES]);
+#endif
 }
 
 inline Bitboard Position::checkers() const {
@@ -21,9 +21,12 @@
 #include <cassert>
 #include <cmath>
 #include <cstring>
+#include <fstream>
+#include <functional>
 #include <iostream>
 #include <sstream>
 
+#include "engine.h"
 #include "evaluate.h"
 #include "movegen.h"
 #include "movepick.h"
@@ -35,20 +38,12 @@
 #include "tt.h"
 #include "ucioption.h"
 
-namespace Search {
-
-  volatile SignalsType Signals;
-  LimitsType Limits;
-  std::vector<RootMove> RootMoves;
-  Position RootPos;
-  Time::point SearchTime;
-  StateStackPtr SetupStates;
-}
-
 using std::string;
 using Eval::evaluate;
 using namespace Search;
 
+extern void check_time(Engine& e);
+
 namespace {
 
   // Different node types, used as template parameter
@@ -71,13 +66,28 @@ namespace {
     return (Depth) Reductions[PvNode][i][std::min(int(d), 63)][std::min(mn, 63)];
   }
 
-  size_t PVIdx;
-  TimeManager TimeMgr;
-  double BestMoveChanges;
-  Value DrawValue[COLOR_NB];
-  HistoryStats History;
-  GainsStats Gains;
-  MovesStats Countermoves, Followupmoves;
+  // The moves of the MovePicker of a node are generated in a list of its thread
+  // indexed by ply, instead of on the stack. The singular extension search runs
+  // at the same ply as the node that started it, so it has its own lists. The
+  // MovePicker of a split point stays in the lists of the master thread.
+  inline ExtMove* move_list(Thread* th, const Stack* ss) {
+    return th->moveLists[ss->excludedMove != MOVE_NONE][ss->ply];
+  }
+
+  // Tests if the SEE of a move is not negative. 'see' is the sign of the SEE
+  // as given by the MovePicker, or VALUE_NONE, and is updated when computed.
+  inline bool see_ge_zero(const Position& pos, Move m, Value& see) {
+
+    if (see == VALUE_NONE)
+        see = pos.see_ge(m, VALUE_ZERO) ? VALUE_KNOWN_WIN : -VALUE_KNOWN_WIN;
+
+    return see >= VALUE_ZERO;
+  }
+
+  // Clock polling from within the search, used instead of the timer thread
+  // when the "Timer Thread" UCI option is disabled.
+  const int PollResolution = 1; // msec between two check_time() calls
+  const int MinPollInterval = 128, MaxPollInterval = 1 << 18; // In nodes
 
   template <NodeType NT, bool SpNode>
   Value search(Position& pos, Stack* ss, Value alpha, Value beta, Depth depth, bool cutNode);
@@ -86,25 +96,33 @@ namespace {
   Value qsearch(Position& pos, Stack* ss, Value alpha, Value beta, Depth depth);
 
   void id_loop(Position& pos);
+  Value shared_window_search(Position& pos, Stack* ss, int depth);
+  Value shared_window_alpha(const Engine& e);
   Value value_to_tt(Value v, int ply);
   Value value_from_tt(Value v, int ply);
+  void update_pv(Move* pv, Move move, Move* childPv);
   void update_stats(const Position& pos, Stack* ss, Move move, Depth depth, Move* quiets, int quietsCnt);
+  void poll_time(Thread* th);
+  double best_move_effort(const Engine& e);
   string uci_pv(const Position& pos, int depth, Value alpha, Value beta);
+  void report_pv(const Position& pos, int depth, Value alpha, Value beta);
 
   struct Skill {
-    Skill(int l, size_t rootSize) : level(l),
-                                    candidates(l < 20 ? std::min(4, (int)rootSize) : 0),
-                                    best(MOVE_NONE) {}
+    Skill(int l, std::vector<RootMove>& rm) : rootMoves(rm), level(l),
+                                              candidates(l < 20 ? std::min(4, (int)rm.size()) : 0),
+                                              best(MOVE_NONE) {}
    ~Skill() {
       if (candidates) // Swap best PV line with the sub-optimal one
-          std::swap(RootMoves[0], *std::find(RootMoves.begin(),
-                    RootMoves.end(), best ? best : pick_move()));
+          std::swap(rootMoves[0], *std::find(rootMoves.begin(),
+                    rootMoves.end(), best ? best : pick_move()));
     }
 
     size_t candidates_size() const { return candidates; }
     bool time_to_pick(int depth) const { return depth == 1 + level; }
     Move pick_move();
 
+    std::vector<RootMove>& rootMoves;
+    RKISS rk;
     int level;
     size_t candidates;
     Move best;
@@ -173,62 +191,94 @@ uint64_t Search::perft(Position& pos, Depth depth) {
 }
 
 template uint64_t Search::perft<true>(Position& pos, Depth depth);
+template uint64_t Search::perft<false>(Position& pos, Depth depth);
 
 
 /// Search::think() is the external interface to Stockfish's search, and is
 /// called by the main thread when the program receives the UCI 'go' command. It
-/// searches from RootPos and at the end prints the "bestmove" to output.
+/// searches from the engine's root position and at the end prints the "bestmove"
+/// to output.
 
-void Search::think() {
+void Search::think(Engine& e) {
 
-  TimeMgr.init(Limits, RootPos.game_ply(), RootPos.side_to_move());
+  e.timeMgr.init(e.limits, e.rootPos.game_ply(), e.rootPos.side_to_move());
 
   int cf = Options["Contempt"] * PawnValueEg / 100; // From centipawns
-  DrawValue[ RootPos.side_to_move()] = VALUE_DRAW - Value(cf);
-  DrawValue[~RootPos.side_to_move()] = VALUE_DRAW + Value(cf);
+  e.drawValue[ e.rootPos.side_to_move()] = VALUE_DRAW - Value(cf);
+  e.drawValue[~e.rootPos.side_to_move()] = VALUE_DRAW + Value(cf);
 
-  if (RootMoves.empty())
+  if (e.rootMoves.empty())
   {
-      RootMoves.push_back(MOVE_NONE);
-      sync_cout << "info depth 0 score "
-                << score_to_uci(RootPos.checkers() ? -VALUE_MATE : VALUE_DRAW)
-                << sync_endl;
+      e.rootMoves.push_back(MOVE_NONE);
+
+      if (!e.onPv)
+          sync_cout << "info depth 0 score "
+                    << score_to_uci(e.rootPos.checkers() ? -VALUE_MATE : VALUE_DRAW)
+                    << sync_endl;
 
       goto finalize;
   }
 
+  e.pollTime = !Options["Timer Thread"];
+  e.writeTimeTrace = Options["Write Time Trace"] && e.limits.use_time_management();
+  e.timeTrace.str("");
+
   // Reset the threads, still sleeping: will wake up at split time
-  for (size_t i = 0; i < Threads.size(); ++i)
-      Threads[i]->maxPly = 0;
+  for (size_t i = 0; i < e.threads.size(); ++i)
+  {
+      e.threads[i]->maxPly = 0;
+      e.threads[i]->pollCalls = 0;
+      e.threads[i]->pollInterval = MinPollInterval;
+      e.threads[i]->lastPollTime = e.searchTime;
+  }
+
+  if (!e.pollTime)
+  {
+      e.threads.timer->run = true;
+      e.threads.timer->notify_one(); // Wake up the recurring timer
+  }
 
-  Threads.timer->run = true;
-  Threads.timer->notify_one(); // Wake up the recurring timer
+  id_loop(e.rootPos); // Let's start searching !
 
-  id_loop(RootPos); // Let's start searching !
+  e.threads.timer->run = false; // Stop the timer
 
-  Threads.timer->run = false; // Stop the timer
+  if (e.writeTimeTrace)
+  {
+      Color us = e.rootPos.side_to_move();
+      std::ofstream file("time_trace.txt", std::ofstream::out | std::ofstream::app);
+
+      file << e.rootPos.game_ply()  << " " << e.limits.time[us] << " " << e.limits.inc[us]
+           << " " << e.limits.movestogo << " " << Time::now() - e.searchTime
+           << e.timeTrace.str() << std::endl;
+  }
 
 finalize:
 
   // When search is stopped this info is not printed
-  sync_cout << "info nodes " << RootPos.nodes_searched()
-            << " time " << Time::now() - SearchTime + 1 << sync_endl;
+  if (!e.onPv)
+      sync_cout << "info nodes " << e.rootPos.nodes_searched()
+                << " time " << Time::now() - e.searchTime + 1 << sync_endl;
 
   // When we reach the maximum depth, we can arrive here without a raise of
-  // Signals.stop. However, if we are pondering or in an infinite search,
+  // signals.stop. However, if we are pondering or in an infinite search,
   // the UCI protocol states that we shouldn't print the best move before the
   // GUI sends a "stop" or "ponderhit" command. We therefore simply wait here
-  // until the GUI sends one of those commands (which also raises Signals.stop).
-  if (!Signals.stop && (Limits.ponder || Limits.infinite))
+  // until the GUI sends one of those commands (which also raises signals.stop).
+  if (!e.signals.stop && (e.limits.ponder || e.limits.infinite))
   {
-      Signals.stopOnPonderhit = true;
-      RootPos.this_thread()->wait_for(Signals.stop);
+      e.signals.stopOnPonderhit = true;
+      e.rootPos.this_thread()->wait_for(e.signals.stop);
   }
 
+  // Try hard to have a ponder move to return to the GUI
+  if (e.rootMoves[0].pv[0] != MOVE_NONE && e.rootMoves[0].pv[1] == MOVE_NONE)
+      e.rootMoves[0].extract_ponder_from_tt(e.rootPos);
+
   // Best move could be MOVE_NONE when searching on a stalemate position
-  sync_cout << "bestmove " << move_to_uci(RootMoves[0].pv[0], RootPos.is_chess960())
-            << " ponder "  << move_to_uci(RootMoves[0].pv[1], RootPos.is_chess960())
-            << sync_endl;
+  if (!e.onPv)
+      sync_cout << "bestmove " << move_to_uci(e.rootMoves[0].pv[0], e.rootPos.is_chess960())
+                << " ponder "  << move_to_uci(e.rootMoves[0].pv[1], e.rootPos.is_chess960())
+                << sync_endl;
 }
 
 
@@ -240,6 +290,7 @@ namespace {
 
   void id_loop(Position& pos) {
 
+    Engine& e = *pos.this_thread()->engine;
     Stack stack[MAX_PLY_PLUS_6], *ss = stack+2; // To allow referencing (ss-2)
     int depth;
     Value bestValue, alpha, beta, delta;
@@ -247,43 +298,51 @@ namespace {
     std::memset(ss-2, 0, 5 * sizeof(Stack));
 
     depth = 0;
-    BestMoveChanges = 0;
+    e.bestMoveChanges = 0;
     bestValue = delta = alpha = -VALUE_INFINITE;
     beta = VALUE_INFINITE;
 
-    TT.new_search();
-    History.clear();
-    Gains.clear();
-    Countermoves.clear();
-    Followupmoves.clear();
+    e.tt.new_search();
+    e.history.clear();
+    e.gains.clear();
+    e.countermoves.clear();
+    e.followupmoves.clear();
 
     size_t multiPV = Options["MultiPV"];
-    Skill skill(Options["Skill Level"], RootMoves.size());
+    Skill skill(Options["Skill Level"], e.rootMoves);
 
     // Do we have to play with skill handicap? In this case enable MultiPV search
     // that we will use behind the scenes to retrieve a set of possible moves.
     multiPV = std::max(multiPV, skill.candidates_size());
 
+    // With a shared window all the PV lines are searched at once
+    e.sharedLines =  Options["MultiPV Shared Window"] && multiPV > 1
+                 ? std::min(multiPV, e.rootMoves.size()) : 0;
+
     // Iterative deepening loop until requested to stop or target depth reached
-    while (++depth <= MAX_PLY && !Signals.stop && (!Limits.depth || depth <= Limits.depth))
+    while (++depth <= MAX_PLY && !e.signals.stop && (!e.limits.depth || depth <= e.limits.depth))
     {
         // Age out PV variability metric
-        BestMoveChanges *= 0.5;
+        e.bestMoveChanges *= 0.5;
+        double prevBestMoveChanges = e.bestMoveChanges;
 
         // Save the last iteration's scores before first PV line is searched and
         // all the move scores except the (new) PV are set to -VALUE_INFINITE.
-        for (size_t i = 0; i < RootMoves.size(); ++i)
-            RootMoves[i].prevScore = RootMoves[i].score;
+        for (size_t i = 0; i < e.rootMoves.size(); ++i)
+            e.rootMoves[i].prevScore = e.rootMoves[i].score;
+
+        if (e.sharedLines)
+            bestValue = shared_window_search(pos, ss, depth);
 
         // MultiPV loop. We perform a full root search for each PV line
-        for (PVIdx = 0; PVIdx < std::min(multiPV, RootMoves.size()) && !Signals.stop; ++PVIdx)
+        for (e.pvIdx = 0; !e.sharedLines && e.pvIdx < std::min(multiPV, e.rootMoves.size()) && !e.signals.stop; ++e.pvIdx)
         {
             // Reset aspiration window starting size
             if (depth >= 5)
             {
                 delta = Value(16);
-                alpha = std::max(RootMoves[PVIdx].prevScore - delta,-VALUE_INFINITE);
-                beta  = std::min(RootMoves[PVIdx].prevScore + delta, VALUE_INFINITE);
+                alpha = std::max(e.rootMoves[e.pvIdx].prevScore - delta,-VALUE_INFINITE);
+                beta  = std::min(e.rootMoves[e.pvIdx].prevScore + delta, VALUE_INFINITE);
             }
 
             // Start with a small aspiration window and, in the case of a fail
@@ -299,24 +358,19 @@ namespace {
                 // and we want to keep the same order for all the moves except the
                 // new PV that goes to the front. Note that in case of MultiPV
                 // search the already searched PV lines are preserved.
-                std::stable_sort(RootMoves.begin() + PVIdx, RootMoves.end());
+                std::stable_sort(e.rootMoves.begin() + e.pvIdx, e.rootMoves.end());
 
-                // Write PV back to transposition table in case the relevant
-                // entries have been overwritten during the search.
-                for (size_t i = 0; i <= PVIdx; ++i)
-                    RootMoves[i].insert_pv_in_tt(pos);
-
-                // If search has been stopped break immediately. Sorting and
-                // writing PV back to TT is safe because RootMoves is still
-                // valid, although it refers to previous iteration.
-                if (Signals.stop)
+                // If search has been stopped break immediately. Sorting is
+                // safe because RootMoves is still valid, although it refers to
+                // previous iteration.
+                if (e.signals.stop)
                     break;
 
                 // When failing high/low give some update (without cluttering
                 // the UI) before a re-search.
                 if (  (bestValue <= alpha || bestValue >= beta)
-                    && Time::now() - SearchTime > 3000)
-                    sync_cout << uci_pv(pos, depth, alpha, beta) << sync_endl;
+                    && Time::now() - e.searchTime > 3000)
+                    report_pv(pos, depth, alpha, beta);
 
                 // In case of failing low/high increase aspiration window and
                 // re-search, otherwise exit the loop.
@@ -324,8 +378,8 @@ namespace {
                 {
                     alpha = std::max(bestValue - delta, -VALUE_INFINITE);
 
-                    Signals.failedLowAtRoot = true;
-                    Signals.stopOnPonderhit = false;
+                    e.signals.failedLowAtRoot = true;
+                    e.signals.stopOnPonderhit = false;
                 }
                 else if (bestValue >= beta)
                     beta = std::min(bestValue + delta, VALUE_INFINITE);
@@ -339,46 +393,155 @@ namespace {
             }
 
             // Sort the PV lines searched so far and update the GUI
-            std::stable_sort(RootMoves.begin(), RootMoves.begin() + PVIdx + 1);
+            std::stable_sort(e.rootMoves.begin(), e.rootMoves.begin() + e.pvIdx + 1);
 
-            if (PVIdx + 1 == std::min(multiPV, RootMoves.size()) || Time::now() - SearchTime > 3000)
-                sync_cout << uci_pv(pos, depth, alpha, beta) << sync_endl;
+            if (e.pvIdx + 1 == std::min(multiPV, e.rootMoves.size()) || Time::now() - e.searchTime > 3000)
+                report_pv(pos, depth, alpha, beta);
         }
 
+        // Record the completed iteration for the time management simulator
+        if (e.writeTimeTrace && !e.signals.stop)
+            e.timeTrace << " " << Time::now() - e.searchTime
+                      << ":" << int(e.bestMoveChanges - prevBestMoveChanges + 0.5)
+                      << ":" << e.signals.failedLowAtRoot
+                      << ":" << int(1000 * best_move_effort(e));
+
         // If skill levels are enabled and time is up, pick a sub-optimal best move
         if (skill.candidates_size() && skill.time_to_pick(depth))
             skill.pick_move();
 
         // Have we found a "mate in x"?
-        if (   Limits.mate
+        if (   e.limits.mate
             && bestValue >= VALUE_MATE_IN_MAX_PLY
-            && VALUE_MATE - bestValue <= 2 * Limits.mate)
-            Signals.stop = true;
+            && VALUE_MATE - bestValue <= 2 * e.limits.mate)
+            e.signals.stop = true;
 
         // Do we have time for the next iteration? Can we stop searching now?
-        if (Limits.use_time_management() && !Signals.stop && !Signals.stopOnPonderhit)
+        if (e.limits.use_time_management() && !e.signals.stop && !e.signals.stopOnPonderhit)
         {
-            // Take some extra time if the best move has changed
+            // Take some extra time if the best move has changed, and scale it
+            // according to the share of the search effort spent on the best move.
             if (depth > 4 && multiPV == 1)
-                TimeMgr.pv_instability(BestMoveChanges);
+            {
+                e.timeMgr.pv_instability(e.bestMoveChanges);
+                e.timeMgr.best_move_effort(best_move_effort(e));
+            }
 
             // Stop the search if only one legal move is available or all
             // of the available time has been used.
-            if (   RootMoves.size() == 1
-                || Time::now() - SearchTime > TimeMgr.available_time())
+            if (   e.rootMoves.size() == 1
+                || Time::now() - e.searchTime > e.timeMgr.available_time())
             {
                 // If we are allowed to ponder do not stop the search now but
                 // keep pondering until the GUI sends "ponderhit" or "stop".
-                if (Limits.ponder)
-                    Signals.stopOnPonderhit = true;
+                if (e.limits.ponder)
+                    e.signals.stopOnPonderhit = true;
                 else
-                    Signals.stop = true;
+                    e.signals.stop = true;
             }
         }
     }
   }
 
 
+  // shared_window_search() is the MultiPV root search used when "MultiPV Shared
+  // Window" is set. Instead of a full root search per PV line, all the root
+  // moves are searched at once with alpha set to the score of the N-th best move
+  // found so far, see search<Root>(). Only the moves that beat this threshold
+  // are re-searched with an open window, to get their exact score and PV. As
+  // in the MultiPV loop we use an aspiration window, here bounded by the scores
+  // of the first and of the N-th line of the previous iteration. After a fail
+  // high or low only the moves whose score is not exact with respect to the new
+  // window are searched again. An iteration interrupted by a stop is discarded.
+
+  Value shared_window_search(Position& pos, Stack* ss, int depth) {
+
+    Engine& e = *pos.this_thread()->engine;
+    std::vector<RootMove> lastIteration(e.rootMoves);
+    Value alpha = -VALUE_INFINITE, beta = VALUE_INFINITE, delta = Value(16);
+
+    if (depth >= 5)
+    {
+        alpha = std::max(e.rootMoves[e.sharedLines - 1].prevScore - delta,-VALUE_INFINITE);
+        beta  = std::min(e.rootMoves[0].prevScore + delta, VALUE_INFINITE);
+    }
+
+    e.sharedDone.clear();
+
+    while (true)
+    {
+        for (size_t i = 0; i < e.rootMoves.size(); ++i)
+            if (!std::count(e.sharedDone.begin(), e.sharedDone.end(), e.rootMoves[i].pv[0]))
+                e.rootMoves[i].score = -VALUE_INFINITE;
+
+        e.pvIdx = 0;
+        e.sharedAlpha = alpha;
+        search<Root, false>(pos, ss, shared_window_alpha(e), beta, depth * ONE_PLY, false);
+
+        if (e.signals.stop)
+        {
+            e.rootMoves = lastIteration;
+            return e.rootMoves[0].score;
+        }
+
+        std::stable_sort(e.rootMoves.begin(), e.rootMoves.end());
+
+        bool failedHigh = e.rootMoves[0].score >= beta;
+        bool failedLow = e.rootMoves[e.sharedLines - 1].score <= alpha;
+
+        if (!failedHigh && !failedLow)
+            break;
+
+        // Moves with a score inside the window are done. Moves that failed low
+        // are done too, unless the N-th line failed low and alpha is lowered.
+        // The moves not searched because all the N lines failed high are not.
+        e.sharedDone.clear();
+
+        for (size_t i = 0; i < e.rootMoves.size(); ++i)
+            if (   e.rootMoves[i].score < beta
+                && e.rootMoves[i].score > -VALUE_INFINITE
+                && (e.rootMoves[i].score > alpha || !failedLow))
+                e.sharedDone.push_back(e.rootMoves[i].pv[0]);
+
+        if (failedHigh)
+            beta = std::min(e.rootMoves[0].score + delta, VALUE_INFINITE);
+
+        if (failedLow)
+        {
+            alpha = std::max(e.rootMoves[e.sharedLines - 1].score - delta, -VALUE_INFINITE);
+
+            e.signals.failedLowAtRoot = true;
+            e.signals.stopOnPonderhit = false;
+        }
+
+        delta += 3 * delta / 8;
+    }
+
+    e.sharedDone.clear();
+    e.pvIdx = e.sharedLines - 1; // All the lines have been updated
+    report_pv(pos, depth, -VALUE_INFINITE, VALUE_INFINITE);
+
+    return e.rootMoves[0].score;
+  }
+
+
+  // shared_window_alpha() returns the score of the N-th best root move searched
+  // so far in a shared window search, or the lower bound of the aspiration
+  // window if there are fewer or they are all below it.
+
+  Value shared_window_alpha(const Engine& e) {
+
+    std::vector<Value> scores;
+
+    for (size_t i = 0; i < e.rootMoves.size(); ++i)
+        scores.push_back(e.rootMoves[i].score);
+
+    std::nth_element(scores.begin(), scores.begin() + e.sharedLines - 1, scores.end(), std::greater<Value>());
+
+    return std::max(scores[e.sharedLines - 1], e.sharedAlpha);
+  }
+
+
   // search<>() is the main search function for both PV and non-PV nodes and for
   // normal and SplitPoint nodes. When called just after a split point the search
   // is simpler because we have already probed the hash table, done a null move
@@ -396,20 +559,22 @@ namespace {
     assert(PvNode || (alpha == beta - 1));
     assert(depth > DEPTH_ZERO);
 
-    Move quietsSearched[64];
+    Move pv[PvNode ? MAX_PLY + 1 : 1], quietsSearched[64];
     StateInfo st;
     const TTEntry *tte;
     SplitPoint* splitPoint;
     Key posKey;
     Move ttMove, move, excludedMove, bestMove;
     Depth ext, newDepth, predictedDepth;
-    Value bestValue, value, ttValue, eval, nullValue, futilityValue;
+    uint64_t nodesBefore;
+    Value bestValue, value, ttValue, eval, nullValue, futilityValue, see;
     bool inCheck, givesCheck, pvMove, singularExtensionNode, improving;
     bool captureOrPromotion, dangerous, doFullDepthSearch;
     int moveCount, quietCount;
 
     // Step 1. Initialize node
     Thread* thisThread = pos.this_thread();
+    Engine& e = *thisThread->engine;
     inCheck = pos.checkers();
 
     if (SpNode)
@@ -426,6 +591,10 @@ namespace {
         goto moves_loop;
     }
 
+    // Read the clock every pollInterval nodes if the timer thread is disabled
+    if (e.pollTime && ++thisThread->pollCalls >= thisThread->pollInterval)
+        poll_time(thisThread);
+
     moveCount = quietCount = 0;
     bestValue = -VALUE_INFINITE;
     ss->currentMove = ss->ttMove = (ss+1)->excludedMove = bestMove = MOVE_NONE;
@@ -440,8 +609,8 @@ namespace {
     if (!RootNode)
     {
         // Step 2. Check for aborted search and immediate draw
-        if (Signals.stop || pos.is_draw() || ss->ply > MAX_PLY)
-            return ss->ply > MAX_PLY && !inCheck ? evaluate(pos) : DrawValue[pos.side_to_move()];
+        if (e.signals.stop || pos.is_draw() || ss->ply > MAX_PLY)
+            return ss->ply > MAX_PLY && !inCheck ? evaluate(pos) : e.drawValue[pos.side_to_move()];
 
         // Step 3. Mate distance pruning. Even if we mate at the next move our score
         // would be at best mate_in(ss->ply+1), but if alpha is already bigger because
@@ -460,21 +629,18 @@ namespace {
     // TT value, so we use a different position key in case of an excluded move.
     excludedMove = ss->excludedMove;
     posKey = excludedMove ? pos.exclusion_key() : pos.key();
-    tte = TT.probe(posKey);
-    ss->ttMove = ttMove = RootNode ? RootMoves[PVIdx].pv[0] : tte ? tte->move() : MOVE_NONE;
+    tte = e.tt.probe(posKey);
+    ss->ttMove = ttMove = RootNode ? e.rootMoves[e.pvIdx].pv[0] : tte ? tte->move() : MOVE_NONE;
     ttValue = tte ? value_from_tt(tte->value(), ss->ply) : VALUE_NONE;
 
-    // At PV nodes we check for exact scores, whilst at non-PV nodes we check for
-    // a fail high/low. The biggest advantage to probing at PV nodes is to have a
-    // smooth experience in analysis mode. We don't probe at Root nodes otherwise
-    // we should also update RootMoveList to avoid bogus output.
-    if (   !RootNode
+    // At non-PV nodes we check for a fail high/low. We don't cut at PV nodes,
+    // that would truncate the PV collected on the stack.
+    if (   !PvNode
         && tte
         && tte->depth() >= depth
         && ttValue != VALUE_NONE // Only in case of TT access race
-        && (           PvNode ?  tte->bound() == BOUND_EXACT
-            : ttValue >= beta ? (tte->bound() &  BOUND_LOWER)
-                              : (tte->bound() &  BOUND_UPPER)))
+        && (ttValue >= beta ? (tte->bound() &  BOUND_LOWER)
+                            : (tte->bound() &  BOUND_UPPER)))
     {
         ss->currentMove = ttMove; // Can be MOVE_NONE
 
@@ -508,7 +674,7 @@ namespace {
         eval = ss->staticEval =
         (ss-1)->currentMove != MOVE_NULL ? evaluate(pos) : -(ss-1)->staticEval + 2 * Eval::Tempo;
 
-        TT.store(posKey, VALUE_NONE, BOUND_NONE, DEPTH_NONE, MOVE_NONE, ss->staticEval);
+        e.tt.store(posKey, VALUE_NONE, BOUND_NONE, DEPTH_NONE, MOVE_NONE, ss->staticEval);
     }
 
     if (   !pos.captured_piece_type()
@@ -519,7 +685,7 @@ namespace {
         &&  type_of(move) == NORMAL)
     {
         Square to = to_sq(move);
-        Gains.update(pos.piece_on(to), to, -(ss-1)->staticEval - ss->staticEval);
+        e.gains.update(pos.piece_on(to), to, -(ss-1)->staticEval - ss->staticEval);
     }
 
     // Step 6. Razoring (skipped when in check)
@@ -606,7 +772,7 @@ namespace {
         assert((ss-1)->currentMove != MOVE_NONE);
         assert((ss-1)->currentMove != MOVE_NULL);
 
-        MovePicker mp(pos, ttMove, History, pos.captured_piece_type());
+        MovePicker mp(pos, move_list(thisThread, ss), ttMove, e.history, pos.captured_piece_type());
         CheckInfo ci(pos);
 
         while ((move = mp.next_move<false>()) != MOVE_NONE)
@@ -631,21 +797,26 @@ namespace {
         search<PvNode ? PV : NonPV, false>(pos, ss, alpha, beta, d / 2, true);
         ss->skipNullMove = false;
 
-        tte = TT.probe(posKey);
+        tte = e.tt.probe(posKey);
         ttMove = tte ? tte->move() : MOVE_NONE;
     }
 
+    // Discard the PV collected by internal iterative deepening, we will get
+    // the real one from the moves loop.
+    if (PvNode && !RootNode)
+        ss->pv[0] = MOVE_NONE;
+
 moves_loop: // When in check and at SpNode search starts from here
 
     Square prevMoveSq = to_sq((ss-1)->currentMove);
-    Move countermoves[] = { Countermoves[pos.piece_on(prevMoveSq)][prevMoveSq].first,
-                            Countermoves[pos.piece_on(prevMoveSq)][prevMoveSq].second };
+    Move countermoves[] = { e.countermoves[pos.piece_on(prevMoveSq)][prevMoveSq].first,
+                            e.countermoves[pos.piece_on(prevMoveSq)][prevMoveSq].second };
 
     Square prevOwnMoveSq = to_sq((ss-2)->currentMove);
-    Move followupmoves[] = { Followupmoves[pos.piece_on(prevOwnMoveSq)][prevOwnMoveSq].first,
-                             Followupmoves[pos.piece_on(prevOwnMoveSq)][prevOwnMoveSq].second };
+    Move followupmoves[] = { e.followupmoves[pos.piece_on(prevOwnMoveSq)][prevOwnMoveSq].first,
+                             e.followupmoves[pos.piece_on(prevOwnMoveSq)][prevOwnMoveSq].second };
 
-    MovePicker mp(pos, ttMove, depth, History, countermoves, followupmoves, ss);
+    MovePicker mp(pos, move_list(thisThread, ss), ttMove, depth, e.history, countermoves, followupmoves, ss);
     CheckInfo ci(pos);
     value = bestValue; // Workaround a bogus 'uninitialized' warning under gcc
     improving =   ss->staticEval >= (ss-2)->staticEval
@@ -665,7 +836,7 @@ moves_loop: // When in check and at SpNode search starts from here
 
     // Step 11. Loop through moves
     // Loop through all pseudo-legal moves until no moves remain or a beta cutoff occurs
-    while ((move = mp.next_move<SpNode>()) != MOVE_NONE)
+    while ((move = mp.next_move<SpNode>(&see)) != MOVE_NONE)
     {
       assert(is_ok(move));
 
@@ -674,8 +845,10 @@ moves_loop: // When in check and at SpNode search starts from here
 
       // At root obey the "searchmoves" option and skip moves not listed in Root
       // Move List. As a consequence any illegal move is also skipped. In MultiPV
-      // mode we also skip PV moves which have been already searched.
-      if (RootNode && !std::count(RootMoves.begin() + PVIdx, RootMoves.end(), move))
+      // mode we also skip PV moves which have been already searched, and in a
+      // shared window search the moves whose score is already known.
+      if (RootNode && (   !std::count(e.rootMoves.begin() + e.pvIdx, e.rootMoves.end(), move)
+                       || std::count(e.sharedDone.begin(), e.sharedDone.end(), move)))
           continue;
 
       if (SpNode)
@@ -692,12 +865,13 @@ moves_loop: // When in check and at SpNode search starts from here
 
       if (RootNode)
       {
-          Signals.firstRootMove = (moveCount == 1);
+          e.signals.firstRootMove = (moveCount == 1);
 
-          if (thisThread == Threads.main() && Time::now() - SearchTime > 3000)
+          if (   thisThread == e.threads.main() && !e.onPv
+              && Time::now() - e.searchTime > 3000)
               sync_cout << "info depth " << depth
                         << " currmove " << move_to_uci(move, pos.is_chess960())
-                        << " currmovenumber " << moveCount + PVIdx << sync_endl;
+                        << " currmovenumber " << moveCount + e.pvIdx << sync_endl;
       }
 
       ext = DEPTH_ZERO;
@@ -712,7 +886,7 @@ moves_loop: // When in check and at SpNode search starts from here
                  || pos.advanced_pawn_push(move);
 
       // Step 12. Extend checks
-      if (givesCheck && pos.see_sign(move) >= VALUE_ZERO)
+      if (givesCheck && see_ge_zero(pos, move, see))
           ext = ONE_PLY;
 
       // Singular extension search. If all moves but one fail low on a search of
@@ -763,7 +937,7 @@ moves_loop: // When in check and at SpNode search starts from here
           if (predictedDepth < 7 * ONE_PLY)
           {
               futilityValue =  ss->staticEval + futility_margin(predictedDepth)
-                             + 128 + Gains[pos.moved_piece(move)][to_sq(move)];
+                             + 128 + e.gains[pos.moved_piece(move)][to_sq(move)];
 
               if (futilityValue <= alpha)
               {
@@ -780,7 +954,7 @@ moves_loop: // When in check and at SpNode search starts from here
           }
 
           // Prune moves with negative SEE at low depths
-          if (predictedDepth < 4 * ONE_PLY && pos.see_sign(move) < VALUE_ZERO)
+          if (predictedDepth < 4 * ONE_PLY && !see_ge_zero(pos, move, see))
           {
               if (SpNode)
                   splitPoint->mutex.lock();
@@ -796,8 +970,10 @@ moves_loop: // When in check and at SpNode search starts from here
           continue;
       }
 
-      pvMove = PvNode && moveCount == 1;
+      pvMove = PvNode && (moveCount == 1 || (RootNode && moveCount <= int(e.sharedLines)));
       ss->currentMove = move;
+      nodesBefore = pos.nodes_searched();
+      (ss+1)->pv = NULL; // Set only for PV searches of the move, see below
       if (!SpNode && !captureOrPromotion && quietCount < 64)
           quietsSearched[quietCount++] = move;
 
@@ -816,7 +992,7 @@ moves_loop: // When in check and at SpNode search starts from here
           ss->reduction = reduction<PvNode>(improving, depth, moveCount);
 
           if (   (!PvNode && cutNode)
-              ||  History[pos.piece_on(to_sq(move))][to_sq(move)] < 0)
+              ||  e.history[pos.piece_on(to_sq(move))][to_sq(move)] < 0)
               ss->reduction += ONE_PLY;
 
           if (move == countermoves[0] || move == countermoves[1])
@@ -826,7 +1002,7 @@ moves_loop: // When in check and at SpNode search starts from here
           if (   ss->reduction
               && type_of(move) == NORMAL
               && type_of(pos.piece_on(to_sq(move))) != PAWN
-              && pos.see(make_move(to_sq(move), from_sq(move))) < 0)
+              && !pos.see_ge(make_move(to_sq(move), from_sq(move)), VALUE_ZERO))
               ss->reduction = std::max(DEPTH_ZERO, ss->reduction - ONE_PLY);
 
           Depth d = std::max(newDepth - ss->reduction, ONE_PLY);
@@ -864,10 +1040,16 @@ moves_loop: // When in check and at SpNode search starts from here
       // high (in the latter case search only if value < beta), otherwise let the
       // parent node fail low with value <= alpha and to try another move.
       if (PvNode && (pvMove || (value > alpha && (RootNode || value < beta))))
+      {
+          (ss+1)->pv = pv;
+          (ss+1)->pv[0] = MOVE_NONE;
+
           value = newDepth <   ONE_PLY ?
                             givesCheck ? -qsearch<PV,  true>(pos, ss+1, -beta, -alpha, DEPTH_ZERO)
                                        : -qsearch<PV, false>(pos, ss+1, -beta, -alpha, DEPTH_ZERO)
                                        : - search<PV, false>(pos, ss+1, -beta, -alpha, newDepth, false);
+      }
+
       // Step 17. Undo move
       pos.undo_move(move);
 
@@ -881,33 +1063,44 @@ moves_loop: // When in check and at SpNode search starts from here
           alpha = splitPoint->alpha;
       }
 
+      // Account the subtree size to the root move, also when search is stopped
+      if (RootNode)
+          std::find(e.rootMoves.begin(), e.rootMoves.end(), move)->nodes += pos.nodes_searched() - nodesBefore;
+
       // Finished searching the move. If a stop or a cutoff occurred, the return
       // value of the search cannot be trusted, and we return immediately without
       // updating best move, PV and TT.
-      if (Signals.stop || thisThread->cutoff_occurred())
+      if (e.signals.stop || thisThread->cutoff_occurred())
           return VALUE_ZERO;
 
       if (RootNode)
       {
-          RootMove& rm = *std::find(RootMoves.begin(), RootMoves.end(), move);
+          RootMove& rm = *std::find(e.rootMoves.begin(), e.rootMoves.end(), move);
 
           // PV move or new best move ?
           if (pvMove || value > alpha)
           {
               rm.score = value;
-              rm.extract_pv_from_tt(pos);
+              rm.pv.resize(1);
+
+              for (Move* m = (ss+1)->pv; m && *m != MOVE_NONE; ++m)
+                  rm.pv.push_back(*m);
+
+              rm.pv.push_back(MOVE_NONE); // Must be zero-terminating
 
               // We record how often the best move has been changed in each
               // iteration. This information is used for time management: When
               // the best move changes frequently, we allocate some more time.
               if (!pvMove)
-                  ++BestMoveChanges;
+                  ++e.bestMoveChanges;
           }
           else
               // All other moves but the PV are set to the lowest value: this is
               // not a problem when sorting because the sort is stable and the
               // move position in the list is preserved - just the PV is pushed up.
-              rm.score = -VALUE_INFINITE;
+              // In a shared window search they keep their upper bound instead,
+              // to tell them apart from the moves left unsearched by a cutoff.
+              rm.score = e.sharedLines ? value : -VALUE_INFINITE;
       }
 
       if (value > bestValue)
@@ -918,9 +1111,13 @@ moves_loop: // When in check and at SpNode search starts from here
           {
               bestMove = SpNode ? splitPoint->bestMove = move : move;
 
+              if (PvNode && !RootNode) // Update pv even in fail-high case
+                  update_pv(SpNode ? splitPoint->ss->pv : ss->pv, move, (ss+1)->pv);
+
               if (PvNode && value < beta) // Update alpha! Always alpha < beta
                   alpha = SpNode ? splitPoint->alpha = value : value;
-              else
+
+              else if (!RootNode || !e.sharedLines) // No cutoff in a shared window root search
               {
                   assert(value >= beta); // Fail high
 
@@ -932,10 +1129,30 @@ moves_loop: // When in check and at SpNode search starts from here
           }
       }
 
+      // In a shared window MultiPV search both alpha and bestValue at root are
+      // the score of the N-th best move, so that only the moves that enter the
+      // best N are re-searched with an open window.
+      if (RootNode && e.sharedLines)
+      {
+          bestValue = alpha = shared_window_alpha(e);
+
+          if (SpNode)
+              splitPoint->bestValue = splitPoint->alpha = alpha;
+
+          if (alpha >= beta) // All the N lines fail high
+          {
+              if (SpNode)
+                  splitPoint->cutoff = true;
+
+              break;
+          }
+      }
+
       // Step 19. Check for splitting the search
       if (   !SpNode
-          &&  Threads.size() >= 2
-          &&  depth >= Threads.minimumSplitDepth
+          &&  e.threads.size() >= 2
+          && (!RootNode || moveCount >= int(e.sharedLines)) // Wait for the first N scores
+          &&  depth >= e.threads.minimumSplitDepth
           &&  (   !thisThread->activeSplitPoint
                || !thisThread->activeSplitPoint->allSlavesSearching)
           &&  thisThread->splitPointsSize < MAX_SPLITPOINTS_PER_THREAD)
@@ -943,9 +1160,9 @@ moves_loop: // When in check and at SpNode search starts from here
           assert(bestValue > -VALUE_INFINITE && bestValue < beta);
 
           thisThread->split(pos, ss, alpha, beta, &bestValue, &bestMove,
-                            depth, moveCount, &mp, NT, cutNode);
+                            depth, &moveCount, &mp, NT, cutNode);
 
-          if (Signals.stop || thisThread->cutoff_occurred())
+          if (e.signals.stop || thisThread->cutoff_occurred())
               return VALUE_ZERO;
 
           if (bestValue >= beta)
@@ -960,23 +1177,30 @@ moves_loop: // When in check and at SpNode search starts from here
     // loop has been completed. But in this case bestValue is valid because we
     // have fully searched our subtree, and we can anyhow save the result in TT.
     /*
-       if (Signals.stop || thisThread->cutoff_occurred())
+       if (e.signals.stop || thisThread->cutoff_occurred())
         return VALUE_DRAW;
     */
 
+#ifdef USE_NODE_STATS
+    // Count the moves tried, split nodes are counted only for their master
+    Search::NodeKind kind = PvNode ? Search::PV_NODES : cutNode ? Search::CUT_NODES : Search::ALL_NODES;
+    thisThread->nodeStats.nodes[kind]++;
+    thisThread->nodeStats.moves[kind] += moveCount;
+#endif
+
     // Step 20. Check for mate and stalemate
     // All legal moves have been searched and if there are no legal moves, it
     // must be mate or stalemate. If we are in a singular extension search then
     // return a fail low score.
     if (!moveCount)
         bestValue = excludedMove ? alpha
-                   :     inCheck ? mated_in(ss->ply) : DrawValue[pos.side_to_move()];
+                   :     inCheck ? mated_in(ss->ply) : e.drawValue[pos.side_to_move()];
 
     // Quiet best move: update killers, history, countermoves and followupmoves
     else if (bestValue >= beta && !pos.capture_or_promotion(bestMove) && !inCheck)
         update_stats(pos, ss, bestMove, depth, quietsSearched, quietCount - 1);
 
-    TT.store(posKey, value_to_tt(bestValue, ss->ply),
+    e.tt.store(posKey, value_to_tt(bestValue, ss->ply),
              bestValue >= beta  ? BOUND_LOWER :
              PvNode && bestMove ? BOUND_EXACT : BOUND_UPPER,
              depth, bestMove, ss->staticEval);
@@ -1002,24 +1226,34 @@ moves_loop: // When in check and at SpNode search starts from here
     assert(PvNode || (alpha == beta - 1));
     assert(depth <= DEPTH_ZERO);
 
+    Move pv[PvNode ? MAX_PLY + 1 : 1];
     StateInfo st;
     const TTEntry* tte;
     Key posKey;
     Move ttMove, move, bestMove;
-    Value bestValue, value, ttValue, futilityValue, futilityBase, oldAlpha;
-    bool givesCheck, evasionPrunable;
+    Value bestValue, value, ttValue, futilityValue, futilityBase, oldAlpha, see;
+    bool givesCheck, evasionPrunable, lazy = false;
     Depth ttDepth;
+    Engine& e = *pos.this_thread()->engine;
 
     // To flag BOUND_EXACT a node with eval above alpha and no available moves
     if (PvNode)
+    {
         oldAlpha = alpha;
+        (ss+1)->pv = pv;
+        ss->pv[0] = MOVE_NONE;
+    }
+
+    Thread* thisThread = pos.this_thread();
+    if (e.pollTime && ++thisThread->pollCalls >= thisThread->pollInterval)
+        poll_time(thisThread);
 
     ss->currentMove = bestMove = MOVE_NONE;
     ss->ply = (ss-1)->ply + 1;
 
     // Check for an instant draw or if the maximum ply has been reached
     if (pos.is_draw() || ss->ply > MAX_PLY)
-        return ss->ply > MAX_PLY && !InCheck ? evaluate(pos) : DrawValue[pos.side_to_move()];
+        return ss->ply > MAX_PLY && !InCheck ? evaluate(pos) : e.drawValue[pos.side_to_move()];
 
     // Decide whether or not to include checks: this fixes also the type of
     // TT entry depth that we are going to use. Note that in qsearch we use
@@ -1029,16 +1263,16 @@ moves_loop: // When in check and at SpNode search starts from here
 
     // Transposition table lookup
     posKey = pos.key();
-    tte = TT.probe(posKey);
+    tte = e.tt.probe(posKey);
     ttMove = tte ? tte->move() : MOVE_NONE;
     ttValue = tte ? value_from_tt(tte->value(),ss->ply) : VALUE_NONE;
 
-    if (   tte
+    if (  !PvNode
+        && tte
         && tte->depth() >= ttDepth
         && ttValue != VALUE_NONE // Only in case of TT access race
-        && (           PvNode ?  tte->bound() == BOUND_EXACT
-            : ttValue >= beta ? (tte->bound() &  BOUND_LOWER)
-                              : (tte->bound() &  BOUND_UPPER)))
+        && (ttValue >= beta ? (tte->bound() &  BOUND_LOWER)
+                            : (tte->bound() &  BOUND_UPPER)))
     {
         ss->currentMove = ttMove; // Can be MOVE_NONE
         return ttValue;
@@ -1056,7 +1290,7 @@ moves_loop: // When in check and at SpNode search starts from here
         {
             // Never assume anything on values stored in TT
             if ((ss->staticEval = bestValue = tte->eval_value()) == VALUE_NONE)
-                ss->staticEval = bestValue = evaluate(pos);
+                ss->staticEval = bestValue = PvNode ? evaluate(pos) : evaluate(pos, alpha, beta, &lazy);
 
             // Can ttValue be used as a better position evaluation?
             if (ttValue != VALUE_NONE)
@@ -1065,13 +1299,19 @@ moves_loop: // When in check and at SpNode search starts from here
         }
         else
             ss->staticEval = bestValue =
-            (ss-1)->currentMove != MOVE_NULL ? evaluate(pos) : -(ss-1)->staticEval + 2 * Eval::Tempo;
+            (ss-1)->currentMove == MOVE_NULL ? -(ss-1)->staticEval + 2 * Eval::Tempo
+          : PvNode                           ? evaluate(pos)
+                                             : evaluate(pos, alpha, beta, &lazy);
+
+        // A lazy evaluation is only a bound, keep it out of the TT eval slot
+        if (lazy)
+            ss->staticEval = VALUE_NONE;
 
         // Stand pat. Return immediately if static value is at least beta
         if (bestValue >= beta)
         {
             if (!tte)
-                TT.store(pos.key(), value_to_tt(bestValue, ss->ply), BOUND_LOWER,
+                e.tt.store(pos.key(), value_to_tt(bestValue, ss->ply), BOUND_LOWER,
                          DEPTH_NONE, MOVE_NONE, ss->staticEval);
 
             return bestValue;
@@ -1087,11 +1327,11 @@ moves_loop: // When in check and at SpNode search starts from here
     // to search the moves. Because the depth is <= 0 here, only captures,
     // queen promotions and checks (only if depth >= DEPTH_QS_CHECKS) will
     // be generated.
-    MovePicker mp(pos, ttMove, depth, History, to_sq((ss-1)->currentMove));
+    MovePicker mp(pos, move_list(thisThread, ss), ttMove, depth, e.history, to_sq((ss-1)->currentMove));
     CheckInfo ci(pos);
 
     // Loop through the moves until no moves remain or a beta cutoff occurs
-    while ((move = mp.next_move<false>()) != MOVE_NONE)
+    while ((move = mp.next_move<false>(&see)) != MOVE_NONE)
     {
       assert(is_ok(move));
 
@@ -1117,10 +1357,15 @@ moves_loop: // When in check and at SpNode search starts from here
               continue;
           }
 
-          if (futilityBase < beta && pos.see(move) <= VALUE_ZERO)
+          if (futilityBase < beta)
           {
-              bestValue = std::max(bestValue, futilityBase);
-              continue;
+              if (!pos.see_ge(move, VALUE_ZERO + 1))
+              {
+                  bestValue = std::max(bestValue, futilityBase);
+                  continue;
+              }
+
+              see = VALUE_KNOWN_WIN;
           }
       }
 
@@ -1135,7 +1380,7 @@ moves_loop: // When in check and at SpNode search starts from here
           && (!InCheck || evasionPrunable)
           &&  move != ttMove
           &&  type_of(move) != PROMOTION
-          &&  pos.see_sign(move) < VALUE_ZERO)
+          && !see_ge_zero(pos, move, see))
           continue;
 
       // Check for legality just before making the move
@@ -1163,10 +1408,11 @@ moves_loop: // When in check and at SpNode search starts from here
               {
                   alpha = value;
                   bestMove = move;
+                  update_pv(ss->pv, move, (ss+1)->pv);
               }
               else // Fail high
               {
-                  TT.store(posKey, value_to_tt(value, ss->ply), BOUND_LOWER,
+                  e.tt.store(posKey, value_to_tt(value, ss->ply), BOUND_LOWER,
                            ttDepth, move, ss->staticEval);
 
                   return value;
@@ -1180,7 +1426,7 @@ moves_loop: // When in check and at SpNode search starts from here
     if (InCheck && bestValue == -VALUE_INFINITE)
         return mated_in(ss->ply); // Plies to mate from the root
 
-    TT.store(posKey, value_to_tt(bestValue, ss->ply),
+    e.tt.store(posKey, value_to_tt(bestValue, ss->ply),
              PvNode && bestValue > oldAlpha ? BOUND_EXACT : BOUND_UPPER,
              ttDepth, bestMove, ss->staticEval);
 
@@ -1215,11 +1461,24 @@ moves_loop: // When in check and at SpNode search starts from here
   }
 
 
+  // update_pv() adds current move and appends child pv[]
+
+  void update_pv(Move* pv, Move move, Move* childPv) {
+
+    for (*pv++ = move; childPv && *childPv != MOVE_NONE; )
+        *pv++ = *childPv++;
+
+    *pv = MOVE_NONE;
+  }
+
+
   // update_stats() updates killers, history, countermoves and followupmoves stats after a fail-high
   // of a quiet move.
 
   void update_stats(const Position& pos, Stack* ss, Move move, Depth depth, Move* quiets, int quietsCnt) {
 
+    Engine& e = *pos.this_thread()->engine;
+
     if (ss->killers[0] != move)
     {
         ss->killers[1] = ss->killers[0];
@@ -1229,40 +1488,73 @@ moves_loop: // When in check and at SpNode search starts from here
     // Increase history value of the cut-off move and decrease all the other
     // played quiet moves.
     Value bonus = Value(4 * int(depth) * int(depth));
-    History.update(pos.moved_piece(move), to_sq(move), bonus);
+    e.history.update(pos.moved_piece(move), to_sq(move), bonus);
     for (int i = 0; i < quietsCnt; ++i)
     {
         Move m = quiets[i];
-        History.update(pos.moved_piece(m), to_sq(m), -bonus);
+        e.history.update(pos.moved_piece(m), to_sq(m), -bonus);
     }
 
     if (is_ok((ss-1)->currentMove))
     {
         Square prevMoveSq = to_sq((ss-1)->currentMove);
-        Countermoves.update(pos.piece_on(prevMoveSq), prevMoveSq, move);
+        e.countermoves.update(pos.piece_on(prevMoveSq), prevMoveSq, move);
     }
 
     if (is_ok((ss-2)->currentMove) && (ss-1)->currentMove == (ss-1)->ttMove)
     {
         Square prevOwnMoveSq = to_sq((ss-2)->currentMove);
-        Followupmoves.update(pos.piece_on(prevOwnMoveSq), prevOwnMoveSq, move);
+        e.followupmoves.update(pos.piece_on(prevOwnMoveSq), prevOwnMoveSq, move);
     }
   }
 
 
+  // poll_time() is called by the search threads instead of the timer thread.
+  // The polling interval, in nodes, is adapted to the speed of the thread so
+  // that the clock is read about every PollResolution msec.
+
+  void poll_time(Thread* th) {
+
+    Time::point now = Time::now();
+
+    if (now - th->lastPollTime < PollResolution)
+        th->pollInterval = std::min(2 * th->pollInterval, MaxPollInterval);
+
+    else if (now - th->lastPollTime > 2 * PollResolution)
+        th->pollInterval = std::max(th->pollInterval / 2, MinPollInterval);
+
+    th->pollCalls = 0;
+    th->lastPollTime = now;
+
+    check_time(*th->engine);
+  }
+
+
+  // best_move_effort() returns the fraction of the nodes searched at root
+  // since the start of the search that were spent on the current best move.
+
+  double best_move_effort(const Engine& e) {
+
+    uint64_t nodes = 0;
+
+    for (size_t i = 0; i < e.rootMoves.size(); ++i)
+        nodes += e.rootMoves[i].nodes;
+
+    return nodes ? double(e.rootMoves[0].nodes) / nodes : 1.0;
+  }
+
+
   // When playing with a strength handicap, choose best move among the first 'candidates'
   // RootMoves using a statistical rule dependent on 'level'. Idea by Heinz van Saanen.
 
   Move Skill::pick_move() {
 
-    static RKISS rk;
-
     // PRNG sequence should be not deterministic
     for (int i = Time::now() % 50; i > 0; --i)
         rk.rand<unsigned>();
 
     // RootMoves are already sorted by score in descending order
-    int variance = std::min(RootMoves[0].score - RootMoves[candidates - 1].score, PawnValueMg);
+    int variance = std::min(rootMoves[0].score - rootMoves[candidates - 1].score, PawnValueMg);
     int weakness = 120 - 2 * level;
     int max_s = -VALUE_INFINITE;
     best = MOVE_NONE;
@@ -1272,20 +1564,20 @@ moves_loop: // When in check and at SpNode search starts from here
     // then we choose the move with the resulting highest score.
     for (size_t i = 0; i < candidates; ++i)
     {
-        int s = RootMoves[i].score;
+        int s = rootMoves[i].score;
 
         // Don't allow crazy blunders even at very low skills
-        if (i > 0 && RootMoves[i - 1].score > s + 2 * PawnValueMg)
+        if (i > 0 && rootMoves[i - 1].score > s + 2 * PawnValueMg)
             break;
 
         // This is our magic formula
-        s += (  weakness * int(RootMoves[0].score - s)
+        s += (  weakness * int(rootMoves[0].score - s)
               + variance * (rk.rand<unsigned>() % weakness)) / 128;
 
         if (s > max_s)
         {
             max_s = s;
-            best = RootMoves[i].pv[0];
+            best = rootMoves[i].pv[0];
         }
     }
     return best;
@@ -1298,107 +1590,89 @@ moves_loop: // When in check and at SpNode search starts from here
 
   string uci_pv(const Position& pos, int depth, Value alpha, Value beta) {
 
+    const Engine& e = *pos.this_thread()->engine;
     std::stringstream ss;
-    Time::point elapsed = Time::now() - SearchTime + 1;
-    size_t uciPVSize = std::min((size_t)Options["MultiPV"], RootMoves.size());
+    Time::point elapsed = Time::now() - e.searchTime + 1;
+    size_t uciPVSize = std::min((size_t)Options["MultiPV"], e.rootMoves.size());
     int selDepth = 0;
 
-    for (size_t i = 0; i < Threads.size(); ++i)
-        if (Threads[i]->maxPly > selDepth)
-            selDepth = Threads[i]->maxPly;
+    for (size_t i = 0; i < e.threads.size(); ++i)
+        if (e.threads[i]->maxPly > selDepth)
+            selDepth = e.threads[i]->maxPly;
 
     for (size_t i = 0; i < uciPVSize; ++i)
     {
-        bool updated = (i <= PVIdx);
+        bool updated = (i <= e.pvIdx);
 
         if (depth == 1 && !updated)
             continue;
 
         int d   = updated ? depth : depth - 1;
-        Value v = updated ? RootMoves[i].score : RootMoves[i].prevScore;
+        Value v = updated ? e.rootMoves[i].score : e.rootMoves[i].prevScore;
 
         if (ss.rdbuf()->in_avail()) // Not at first line
             ss << "\n";
 
         ss << "info depth " << d
            << " seldepth "  << selDepth
-           << " score "     << (i == PVIdx ? score_to_uci(v, alpha, beta) : score_to_uci(v))
+           << " score "     << (i == e.pvIdx ? score_to_uci(v, alpha, beta) : score_to_uci(v))
            << " nodes "     << pos.nodes_searched()
            << " nps "       << pos.nodes_searched() * 1000 / elapsed
            << " time "      << elapsed
            << " multipv "   << i + 1
            << " pv";
 
-        for (size_t j = 0; RootMoves[i].pv[j] != MOVE_NONE; ++j)
-            ss << " " << move_to_uci(RootMoves[i].pv[j], pos.is_chess960());
+        for (size_t j = 0; e.rootMoves[i].pv[j] != MOVE_NONE; ++j)
+            ss << " " << move_to_uci(e.rootMoves[i].pv[j], pos.is_chess960());
     }
 
     return ss.str();
   }
 
-} // namespace
-
-
-/// RootMove::extract_pv_from_tt() builds a PV by adding moves from the TT table.
-/// We also consider both failing high nodes and BOUND_EXACT nodes here to
-/// ensure that we have a ponder move even when we fail high at root. This
-/// results in a long PV to print that is important for position analysis.
-
-void RootMove::extract_pv_from_tt(Position& pos) {
-
-  StateInfo state[MAX_PLY_PLUS_6], *st = state;
-  const TTEntry* tte;
-  int ply = 1;    // At root ply is 1...
-  Move m = pv[0]; // ...instead pv[] array starts from 0
-  Value expectedScore = score;
-
-  pv.clear();
-
-  do {
-      pv.push_back(m);
-
-      assert(MoveList<LEGAL>(pos).contains(pv[ply - 1]));
 
-      pos.do_move(pv[ply++ - 1], *st++);
-      tte = TT.probe(pos.key());
-      expectedScore = -expectedScore;
+  // report_pv() passes the PV lines to the hook set by the embedding application,
+  // if any, otherwise prints them in UCI format.
 
-  } while (   tte
-           && expectedScore == value_from_tt(tte->value(), ply)
-           && pos.pseudo_legal(m = tte->move()) // Local copy, TT could change
-           && pos.legal(m, pos.pinned_pieces(pos.side_to_move()))
-           && ply < MAX_PLY
-           && (!pos.is_draw() || ply <= 2));
+  void report_pv(const Position& pos, int depth, Value alpha, Value beta) {
 
-  pv.push_back(MOVE_NONE); // Must be zero-terminating
-
-  while (--ply) pos.undo_move(pv[ply - 1]);
-}
+    const Engine& e = *pos.this_thread()->engine;
 
+    if (e.onPv)
+        e.onPv(e, depth, alpha, beta);
+    else
+        sync_cout << uci_pv(pos, depth, alpha, beta) << sync_endl;
+  }
 
-/// RootMove::insert_pv_in_tt() is called at the end of a search iteration, and
-/// inserts the PV back into the TT. This makes sure the old PV moves are searched
-/// first, even if the old TT entries have been overwritten.
+} // namespace
 
-void RootMove::insert_pv_in_tt(Position& pos) {
 
-  StateInfo state[MAX_PLY_PLUS_6], *st = state;
-  const TTEntry* tte;
-  int idx = 0; // Ply starts from 1, we need to start from 0
+/// RootMove::extract_ponder_from_tt() is called in case we have no ponder move
+/// before exiting the search, for instance in case we stop the search during a
+/// fail high at root, when the PV collected by the search is just the best move.
+/// We try to get a ponder move from the TT, otherwise in case of 'ponder on' we
+/// would have nothing to think on.
 
-  do {
-      tte = TT.probe(pos.key());
+bool RootMove::extract_ponder_from_tt(Position& pos) {
 
-      if (!tte || tte->move() != pv[idx]) // Don't overwrite correct entries
-          TT.store(pos.key(), VALUE_NONE, BOUND_NONE, DEPTH_NONE, pv[idx], VALUE_NONE);
+  StateInfo st;
+  bool found = false;
 
-      assert(MoveList<LEGAL>(pos).contains(pv[idx]));
+  assert(pv.size() == 2 && pv[1] == MOVE_NONE);
 
-      pos.do_move(pv[idx++], *st++);
+  pos.do_move(pv[0], st);
+  const TTEntry* tte = pos.this_thread()->engine->tt.probe(pos.key());
+  Move m = tte ? tte->move() : MOVE_NONE; // Local copy, TT could change
 
-  } while (pv[idx] != MOVE_NONE);
+  if (   m != MOVE_NONE
+      && pos.pseudo_legal(m)
+      && pos.legal(m, pos.pinned_pieces(pos.side_to_move())))
+  {
+      pv.insert(pv.begin() + 1, m);
+      found = true;
+  }
 
-  while (idx) pos.undo_move(pv[--idx]);
+  pos.undo_move(pv[0]);
+  return found;
 }
 
 
@@ -1417,12 +1691,12 @@ void Thread::idle_loop() {
       // If this thread has been assigned work, launch a search
       while (searching)
       {
-          Threads.mutex.lock();
+          engine->threads.mutex.lock();
 
           assert(activeSplitPoint);
           SplitPoint* sp = activeSplitPoint;
 
-          Threads.mutex.unlock();
+          engine->threads.mutex.unlock();
 
           Stack stack[MAX_PLY_PLUS_6], *ss = stack+2; // To allow referencing (ss-2)
           Position pos(*sp->pos, this);
@@ -1472,22 +1746,22 @@ void Thread::idle_loop() {
 
           // Try to late join to another split point if none of its slaves has
           // already finished.
-          if (Threads.size() > 2)
-              for (size_t i = 0; i < Threads.size(); ++i)
+          if (engine->threads.size() > 2)
+              for (size_t i = 0; i < engine->threads.size(); ++i)
               {
-                  const int size = Threads[i]->splitPointsSize; // Local copy
-                  sp = size ? &Threads[i]->splitPoints[size - 1] : NULL;
+                  const int size = engine->threads[i]->splitPointsSize; // Local copy
+                  sp = size ? &engine->threads[i]->splitPoints[size - 1] : NULL;
 
                   if (   sp
                       && sp->allSlavesSearching
-                      && available_to(Threads[i]))
+                      && available_to(engine->threads[i]))
                   {
                       // Recheck the conditions under lock protection
-                      Threads.mutex.lock();
+                      engine->threads.mutex.lock();
                       sp->mutex.lock();
 
                       if (   sp->allSlavesSearching
-                          && available_to(Threads[i]))
+                          && available_to(engine->threads[i]))
                       {
                            sp->slavesMask.set(idx);
                            activeSplitPoint = sp;
@@ -1495,7 +1769,7 @@ void Thread::idle_loop() {
                       }
 
                       sp->mutex.unlock();
-                      Threads.mutex.unlock();
+                      engine->threads.mutex.unlock();
 
                       break; // Just a single attempt
                   }
@@ -1523,61 +1797,62 @@ void Thread::idle_loop() {
 }
 
 
-/// check_time() is called by the timer thread when the timer triggers. It is
-/// used to print debug info and, more importantly, to detect when we are out of
-/// available time and thus stop the search.
+/// check_time() is called by the timer thread when the timer triggers, or by
+/// the search threads through poll_time() when the timer thread is disabled. It
+/// is used to print debug info and, more importantly, to detect when we are out
+/// of available time and thus stop the search.
 
-void check_time() {
+void check_time(Engine& e) {
 
-  static Time::point lastInfoTime = Time::now();
   int64_t nodes = 0; // Workaround silly 'uninitialized' gcc warning
 
-  if (Time::now() - lastInfoTime >= 1000)
+  if (Time::now() - e.lastInfoTime >= 1000)
   {
-      lastInfoTime = Time::now();
+      e.lastInfoTime = Time::now();
       dbg_print();
   }
 
-  if (Limits.ponder)
+  if (e.limits.ponder)
       return;
 
-  if (Limits.nodes)
+  if (e.limits.nodes)
   {
-      Threads.mutex.lock();
+      e.threads.mutex.lock();
 
-      nodes = RootPos.nodes_searched();
+      nodes = e.rootPos.nodes_searched();
 
       // Loop across all split points and sum accumulated SplitPoint nodes plus
       // all the currently active positions nodes.
-      for (size_t i = 0; i < Threads.size(); ++i)
-          for (int j = 0; j < Threads[i]->splitPointsSize; ++j)
+      for (size_t i = 0; i < e.threads.size(); ++i)
+          for (int j = 0; j < e.threads[i]->splitPointsSize; ++j)
           {
-              SplitPoint& sp = Threads[i]->splitPoints[j];
+              SplitPoint& sp = e.threads[i]->splitPoints[j];
 
               sp.mutex.lock();
 
               nodes += sp.nodes;
 
-              for (size_t idx = 0; idx < Threads.size(); ++idx)
-                  if (sp.slavesMask.test(idx) && Threads[idx]->activePosition)
-                      nodes += Threads[idx]->activePosition->nodes_searched();
+              for (size_t idx = 0; idx < e.threads.size(); ++idx)
+                  if (sp.slavesMask.test(idx) && e.threads[idx]->activePosition)
+                      nodes += e.threads[idx]->activePosition->nodes_searched();
 
               sp.mutex.unlock();
           }
 
-      Threads.mutex.unlock();
+      e.threads.mutex.unlock();
   }
 
-  Time::point elapsed = Time::now() - SearchTime;
-  bool stillAtFirstMove =    Signals.firstRootMove
-                         && !Signals.failedLowAtRoot
-                         &&  elapsed > TimeMgr.available_time() * 75 / 100;
+  Time::point elapsed = Time::now() - e.searchTime;
+  bool stillAtFirstMove =    e.signals.firstRootMove
+                         && !e.signals.failedLowAtRoot
+                         &&  elapsed > e.timeMgr.available_time() * 75 / 100;
 
-  bool noMoreTime =   elapsed > TimeMgr.maximum_time() - 2 * TimerThread::Resolution
+  int resolution = e.pollTime ? PollResolution : TimerThread::Resolution;
+  bool noMoreTime =   elapsed > e.timeMgr.maximum_time() - 2 * resolution
                    || stillAtFirstMove;
 
-  if (   (Limits.use_time_management() && noMoreTime)
-      || (Limits.movetime && elapsed >= Limits.movetime)
-      || (Limits.nodes && nodes >= Limits.nodes))
-      Signals.stop = true;
+  if (   (e.limits.use_time_management() && noMoreTime)
+      || (e.limits.movetime && elapsed >= e.limits.movetime)
+      || (e.limits.nodes && nodes >= e.limits.nodes))
+      e.signals.stop = true;
 }
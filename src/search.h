@@ -20,6 +20,7 @@
 #ifndef SEARCH_H_INCLUDED
 #define SEARCH_H_INCLUDED
 
+#include <cstring>
 #include <memory>
 #include <stack>
 #include <vector>
@@ -28,6 +29,7 @@
 #include "position.h"
 #include "types.h"
 
+struct Engine;
 struct SplitPoint;
 
 namespace Search {
@@ -38,6 +40,7 @@ namespace Search {
 
 struct Stack {
   SplitPoint* splitPoint;
+  Move* pv;
   int ply;
   Move currentMove;
   Move ttMove;
@@ -52,21 +55,22 @@ struct Stack {
 /// RootMove struct is used for moves at the root of the tree. For each root
 /// move we store a score, a node count, and a PV (really a refutation in the
 /// case of moves which fail low). Score is normally set at -VALUE_INFINITE for
-/// all non-pv moves.
+/// all non-pv moves. The node count is the size of the move's subtree summed
+/// over all the iterations of the current search.
 struct RootMove {
 
-  RootMove(Move m) : score(-VALUE_INFINITE), prevScore(-VALUE_INFINITE) {
+  RootMove(Move m) : score(-VALUE_INFINITE), prevScore(-VALUE_INFINITE), nodes(0) {
     pv.push_back(m); pv.push_back(MOVE_NONE);
   }
 
   bool operator<(const RootMove& m) const { return score > m.score; } // Ascending sort
   bool operator==(const Move& m) const { return pv[0] == m; }
 
-  void extract_pv_from_tt(Position& pos);
-  void insert_pv_in_tt(Position& pos);
+  bool extract_ponder_from_tt(Position& pos);
 
   Value score;
   Value prevScore;
+  uint64_t nodes;
   std::vector<Move> pv;
 };
 
@@ -95,17 +99,22 @@ struct SignalsType {
   bool stop, stopOnPonderhit, firstRootMove, failedLowAtRoot;
 };
 
-typedef std::auto_ptr<std::stack<StateInfo> > StateStackPtr;
+/// NodeStats counts, for each type of node, the nodes of the main search and
+/// the moves tried there, to see how many of the ordered moves are used. The
+/// counters are compiled only with nodestats=yes or debug=yes in the Makefile.
+
+enum NodeKind { PV_NODES, CUT_NODES, ALL_NODES, NODE_KIND_NB };
+
+struct NodeStats {
+  NodeStats() { std::memset(this, 0, sizeof(NodeStats)); }
 
-extern volatile SignalsType Signals;
-extern LimitsType Limits;
-extern std::vector<RootMove> RootMoves;
-extern Position RootPos;
-extern Time::point SearchTime;
-extern StateStackPtr SetupStates;
+  uint64_t nodes[NODE_KIND_NB], moves[NODE_KIND_NB];
+};
+
+typedef std::auto_ptr<std::stack<StateInfo> > StateStackPtr;
 
 extern void init();
-extern void think();
+extern void think(Engine& e);
 template<bool Root> uint64_t perft(Position& pos, Depth depth);
 
 } // namespace Search
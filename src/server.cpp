@@ -0,0 +1,640 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2014 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "engine.h"
+#include "movegen.h"
+#include "notation.h"
+#include "ucioption.h"
+
+using namespace std;
+
+#ifndef _WIN32 // Unix domain sockets
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+  // FEN string of the initial position, normal chess
+  const char* StartFEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+  // Search time of the requests without any limit, in msec
+  const int DefaultMoveTime = 1000;
+
+  struct Server;
+
+  // A client connection. It is closed when the client has closed its side and
+  // all its requests are answered.
+  struct Connection {
+    Server* server;
+    int fd;
+    Mutex mutex;
+    int pending;
+    bool eof;
+  };
+
+  struct Request {
+    Connection* conn;
+    string id, fen, moves;
+    Search::LimitsType limits;
+  };
+
+  // The queue of the requests waiting for a worker and the open connections
+  struct Server {
+    Mutex mutex;
+    ConditionVariable sleepCondition;
+    deque<Request> queue;
+    set<Connection*> connections;
+    TranspositionTable* tt;
+    int listenFd, readers, workers, served;
+    bool quit;
+  };
+
+  struct Worker {
+    Engine engine;
+    NativeHandle handle;
+    Server* server;
+  };
+
+  struct Reader {
+    NativeHandle handle;
+    Server* server;
+    Connection* conn;
+  };
+
+
+  // no_output() is the PV hook of the engines, the result is sent at the end
+
+  void no_output(const Engine&, int, Value, Value) {}
+
+
+  // release() decrements the count of the requests of the connection, or marks
+  // it as closed by the client, and closes and frees it when both are done.
+
+  void release(Connection* c, bool eof) {
+
+    c->mutex.lock();
+
+    c->eof |= eof;
+    c->pending -= !eof;
+    bool done = c->eof && !c->pending;
+
+    c->mutex.unlock();
+
+    if (done)
+    {
+        c->server->mutex.lock();
+        c->server->connections.erase(c);
+        c->server->mutex.unlock();
+
+        close(c->fd);
+        delete c;
+    }
+  }
+
+
+  // send_line() writes a line to the client, serialized with the other workers
+  // answering on the same connection. Errors are ignored: the client is gone.
+
+  void send_line(Connection* c, const string& line) {
+
+    string s = line + "\n";
+
+    c->mutex.lock();
+
+    for (size_t sent = 0; sent < s.size(); )
+    {
+        ssize_t n = send(c->fd, s.data() + sent, s.size() - sent, MSG_NOSIGNAL);
+
+        if (n <= 0)
+            break;
+
+        sent += n;
+    }
+
+    c->mutex.unlock();
+  }
+
+
+  // fen_is_ok() checks the FEN of a request before it is given to Position,
+  // which assumes a correct one: 8 ranks of 8 squares, one king and at most 16
+  // pieces and 8 pawns per side, no pawn on the first or last rank, and for
+  // each castling right a king on its first rank and the rook to castle with.
+
+  bool fen_is_ok(const string& fen) {
+
+    const string PieceChars(" PNBRQK  pnbrqk");
+    Piece board[SQUARE_NB];
+    int pieces[COLOR_NB] = { 0, 0 }, pawns[COLOR_NB] = { 0, 0 }, kings[COLOR_NB] = { 0, 0 };
+    Square ksq[COLOR_NB] = { SQ_NONE, SQ_NONE };
+    istringstream is(fen);
+    string placement, side, castling;
+    int rank = 7, file = 0;
+    size_t idx;
+
+    if (!(is >> placement >> side) || (side != "w" && side != "b"))
+        return false;
+
+    std::fill(board, board + SQUARE_NB, NO_PIECE);
+
+    for (size_t i = 0; i < placement.size(); ++i)
+    {
+        char token = placement[i];
+
+        if (token == '/')
+        {
+            if (file != 8 || --rank < 0)
+                return false;
+
+            file = 0;
+        }
+        else if (token >= '1' && token <= '8')
+        {
+            if ((file += token - '0') > 8)
+                return false;
+        }
+        else if ((idx = PieceChars.find(token)) != string::npos && token != ' ')
+        {
+            if (file > 7)
+                return false;
+
+            Piece pc = Piece(idx);
+            Color c = color_of(pc);
+            Square s = make_square(File(file++), Rank(rank));
+
+            board[s] = pc;
+            ++pieces[c];
+
+            if (type_of(pc) == PAWN)
+            {
+                if (rank == 0 || rank == 7)
+                    return false;
+
+                ++pawns[c];
+            }
+            else if (type_of(pc) == KING)
+            {
+                ++kings[c];
+                ksq[c] = s;
+            }
+        }
+        else
+            return false;
+    }
+
+    if (   rank != 0 || file != 8
+        || kings[WHITE] != 1 || kings[BLACK] != 1
+        || pieces[WHITE] > 16 || pieces[BLACK] > 16
+        || pawns[WHITE] > 8 || pawns[BLACK] > 8)
+        return false;
+
+    if (!(is >> castling) || castling == "-")
+        return true;
+
+    for (size_t i = 0; i < castling.size(); ++i)
+    {
+        Color c = islower(castling[i]) ? BLACK : WHITE;
+        char token = char(toupper(castling[i]));
+        Piece rook = make_piece(c, ROOK);
+        Square rsq = SQ_NONE;
+
+        if (relative_rank(c, ksq[c]) != RANK_1)
+            return false;
+
+        // Find the rook as Position::set() does, the first one from the corner
+        if (token == 'K')
+        {
+            for (File f = FILE_H; f > file_of(ksq[c]) && rsq == SQ_NONE; --f)
+                if (type_of(board[make_square(f, rank_of(ksq[c]))]) == ROOK)
+                    rsq = make_square(f, rank_of(ksq[c]));
+        }
+        else if (token == 'Q')
+        {
+            for (File f = FILE_A; f < file_of(ksq[c]) && rsq == SQ_NONE; ++f)
+                if (type_of(board[make_square(f, rank_of(ksq[c]))]) == ROOK)
+                    rsq = make_square(f, rank_of(ksq[c]));
+        }
+        else if (token >= 'A' && token <= 'H')
+            rsq = make_square(File(token - 'A'), rank_of(ksq[c]));
+        else
+            return false;
+
+        if (rsq == SQ_NONE || board[rsq] != rook)
+            return false;
+    }
+
+    return true;
+  }
+
+
+  // position_is_ok() checks the position set up from a request: the side not
+  // to move is not in check, and an en passant square is empty and has the pawn
+  // to capture in front of it.
+
+  bool position_is_ok(const Position& pos) {
+
+    Color us = pos.side_to_move();
+    Square ep = pos.ep_square();
+
+    return   pos.pos_is_ok()
+          && !(pos.attackers_to(pos.king_square(~us)) & pos.pieces(us))
+          && (   ep == SQ_NONE
+              || (pos.empty(ep) && pos.piece_on(ep - pawn_push(us)) == make_piece(~us, PAWN)));
+  }
+
+
+  // parse_request() reads a request line in the form
+  //
+  //   <id> startpos|fen <fen> [moves <move>...] [depth <d>] [nodes <n>] [movetime <ms>]
+  //
+  // The id is any word chosen by the client to match the answer.
+
+  bool parse_request(const string& line, Request& r) {
+
+    istringstream is(line);
+    string token;
+
+    if (!(is >> r.id >> token))
+        return false;
+
+    if (token == "startpos")
+        r.fen = StartFEN;
+
+    else if (token != "fen")
+        return false;
+
+    bool moves = false;
+
+    while (is >> token)
+    {
+        if (token == "depth")
+            is >> r.limits.depth;
+
+        else if (token == "nodes")
+            is >> r.limits.nodes;
+
+        else if (token == "movetime")
+            is >> r.limits.movetime;
+
+        else if (token == "moves")
+            moves = true;
+
+        else if (moves)
+            r.moves += token + " ";
+
+        else if (r.fen != StartFEN)
+            r.fen += token + " ";
+    }
+
+    if (!r.limits.depth && !r.limits.nodes && !r.limits.movetime)
+        r.limits.movetime = DefaultMoveTime;
+
+    return !r.fen.empty();
+  }
+
+
+  // push() queues a request, or stops the server if NULL, and wakes up a
+  // worker. Returns false if the server is stopping.
+
+  bool push(Server& s, const Request* r) {
+
+    s.mutex.lock();
+
+    bool ok = !s.quit;
+
+    if (!r)
+        s.quit = true;
+
+    else if (ok)
+        s.queue.push_back(*r);
+
+    s.sleepCondition.notify_one();
+    s.mutex.unlock();
+
+    return ok;
+  }
+
+
+  // read_requests() is the loop of the thread reading the requests of a
+  // connection, one per line. The line 'shutdown' stops the server.
+
+  extern "C" long read_requests(Reader* rd) {
+
+    Connection* c = rd->conn;
+    string buffer;
+    char chunk[4096];
+    ssize_t n;
+
+    while ((n = recv(c->fd, chunk, sizeof(chunk), 0)) > 0)
+    {
+        size_t pos;
+
+        buffer.append(chunk, n);
+
+        while ((pos = buffer.find('\n')) != string::npos)
+        {
+            string line = buffer.substr(0, pos);
+            Request r;
+
+            buffer.erase(0, pos + 1);
+
+            if (line.find_first_not_of(" \t\r") == string::npos)
+                continue;
+
+            if (line.compare(0, 8, "shutdown") == 0)
+            {
+                push(*rd->server, NULL);
+                shutdown(rd->server->listenFd, SHUT_RDWR); // Unblocks accept()
+                break;
+            }
+
+            if (!parse_request(line, r))
+            {
+                send_line(c, "error invalid request: " + line);
+                continue;
+            }
+
+            c->mutex.lock();
+            c->pending++;
+            c->mutex.unlock();
+
+            r.conn = c;
+
+            if (!push(*rd->server, &r))
+            {
+                release(c, false);
+                break;
+            }
+        }
+    }
+
+    release(c, true);
+
+    Server& s = *rd->server;
+    delete rd;
+
+    s.mutex.lock();
+    s.readers--;
+    s.sleepCondition.notify_one();
+    s.mutex.unlock();
+
+    return 0;
+  }
+
+
+  // serve_requests() is the loop of the workers: they search the queued
+  // requests one at a time and send back the result. When the server stops
+  // they exit once the queue is empty.
+
+  extern "C" long serve_requests(Worker* w) {
+
+    Server& s = *w->server;
+    Engine& e = w->engine;
+
+    while (true)
+    {
+        s.mutex.lock();
+
+        while (s.queue.empty() && !s.quit)
+            s.sleepCondition.wait(s.mutex);
+
+        if (s.queue.empty())
+        {
+            s.sleepCondition.notify_one(); // Pass it on to the next worker
+            s.mutex.unlock();
+            break;
+        }
+
+        Request r = s.queue.front();
+        s.queue.pop_front();
+
+        // The shared hash ages once per round of requests, one per worker, so
+        // that the searches running together see their entries as current.
+        if (s.served++ % s.workers == 0)
+            s.tt->new_search();
+
+        s.mutex.unlock();
+
+        Search::StateStackPtr states(new std::stack<StateInfo>());
+        bool invalid = !fen_is_ok(r.fen);
+        Position pos(invalid ? StartFEN : r.fen, Options["UCI_Chess960"], e.threads.main());
+        istringstream is(r.moves);
+        string token;
+        Move m;
+        bool illegal = false;
+
+        invalid = invalid || !position_is_ok(pos);
+
+        while (!invalid && is >> token)
+        {
+            if ((m = move_from_uci(pos, token)) == MOVE_NONE)
+            {
+                illegal = true;
+                break;
+            }
+
+            states->push(StateInfo());
+            pos.do_move(m, states->top());
+        }
+
+        stringstream ss;
+
+        if (invalid)
+            ss << r.id << " error invalid position";
+
+        else if (illegal)
+            ss << r.id << " error illegal move " << token;
+
+        else if (!MoveList<LEGAL>(pos).size())
+            ss << r.id << " bestmove (none)";
+        else
+        {
+            Time::point start = Time::now();
+
+            e.threads.start_thinking(pos, r.limits, states);
+            e.threads.wait_for_think_finished();
+
+            const Search::RootMove& rm = e.rootMoves[0];
+
+            ss << r.id << " bestmove " << move_to_uci(rm.pv[0], pos.is_chess960())
+               << " score " << score_to_uci(rm.score)
+               << " nodes " << e.rootPos.nodes_searched()
+               << " time " << Time::now() - start
+               << " pv";
+
+            for (size_t i = 0; rm.pv[i] != MOVE_NONE; ++i)
+                ss << " " << move_to_uci(rm.pv[i], pos.is_chess960());
+        }
+
+        send_line(r.conn, ss.str());
+        release(r.conn, false);
+    }
+
+    return 0;
+  }
+
+} // namespace
+
+
+/// serve() runs an analysis server listening on a Unix domain socket, so that
+/// clients do not pay the engine startup at every request. Clients send one
+/// request per line, see parse_request(), and can send many of them without
+/// waiting for the answers. The requests of all the clients are served in
+/// arrival order by a fixed pool of workers, each one an engine with a single
+/// search thread, sharing one transposition table that stays warm between the
+/// requests. Each answer is a line starting with the id of the request:
+///
+///   <id> bestmove <move> score cp|mate <x> nodes <n> time <ms> pv <moves>
+///
+/// or '<id> error invalid position' if the FEN of the request is not a valid
+/// position, or '<id> error illegal move <move>' if a move is not legal.
+/// The parameters are the socket path, the number of workers (default is the
+/// "Threads" option) and the hash size in MB (default is the "Hash" option).
+/// The server runs until a client sends 'shutdown'.
+
+void serve(istream& is) {
+
+  string path, token;
+  Server server;
+
+  is >> path;
+  int workers = (is >> token) ? atoi(token.c_str()) : int(Options["Threads"]);
+  int hash    = (is >> token) ? atoi(token.c_str()) : int(Options["Hash"]);
+
+  sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+
+  if (path.empty() || path.size() >= sizeof(addr.sun_path))
+  {
+      cerr << "Invalid socket path " << path << endl;
+      return;
+  }
+
+  strcpy(addr.sun_path, path.c_str());
+  unlink(path.c_str()); // Remove a stale socket from a previous run
+
+  server.listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+  server.readers = 0;
+  server.quit = false;
+
+  if (   server.listenFd < 0
+      || bind(server.listenFd, (sockaddr*)&addr, sizeof(addr)) < 0
+      || listen(server.listenFd, 64) < 0)
+  {
+      cerr << "Unable to listen on " << path << endl;
+      return;
+  }
+
+  workers = std::min(std::max(workers, 1), MAX_THREADS);
+  TranspositionTable tt;
+  vector<Worker*> pool;
+
+  tt.resize(std::max(hash, 1));
+  server.tt = &tt;
+  server.workers = workers;
+  server.served = 0;
+
+  for (int i = 0; i < workers; ++i)
+  {
+      Worker* w = new Worker;
+
+      w->engine.init(1, 0); // No own hash, see share()
+      w->engine.tt.share(tt);
+      w->engine.onPv = no_output;
+      w->server = &server;
+
+      thread_create(w->handle, serve_requests, w);
+      pool.push_back(w);
+  }
+
+  sync_cout << "info string listening on " << path << " with " << workers
+            << " workers" << sync_endl;
+
+  int fd;
+
+  while ((fd = accept(server.listenFd, NULL, NULL)) >= 0)
+  {
+      Reader* rd = new Reader;
+
+      rd->server = &server;
+      rd->conn = new Connection;
+      rd->conn->server = &server;
+      rd->conn->fd = fd;
+      rd->conn->pending = 0;
+      rd->conn->eof = false;
+
+      server.mutex.lock();
+      server.connections.insert(rd->conn);
+      server.readers++;
+      server.mutex.unlock();
+
+      thread_create(rd->handle, read_requests, rd);
+      pthread_detach(rd->handle);
+  }
+
+  // Stop reading new requests, let the workers answer the queued ones and wait
+  // for the readers to release their connections.
+  server.mutex.lock();
+
+  for (set<Connection*>::iterator it = server.connections.begin(); it != server.connections.end(); ++it)
+      shutdown((*it)->fd, SHUT_RD);
+
+  server.mutex.unlock();
+
+  push(server, NULL);
+
+  for (size_t i = 0; i < pool.size(); ++i)
+  {
+      thread_join(pool[i]->handle);
+
+      pool[i]->engine.exit();
+      delete pool[i];
+  }
+
+  server.mutex.lock();
+
+  while (server.readers)
+      server.sleepCondition.wait(server.mutex);
+
+  server.mutex.unlock();
+
+  close(server.listenFd);
+  unlink(path.c_str());
+}
+
+#else
+
+void serve(istream&) {
+
+  cerr << "The analysis server needs Unix domain sockets" << endl;
+}
+
+#endif
@@ -0,0 +1,119 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2014 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/* C interface of libstockfish.so, built with 'make library ARCH=arch'. It
+   allows to embed one or more engines in a process and to get the search
+   results as structured data, without going through the UCI protocol. */
+
+#ifndef STOCKFISH_H_INCLUDED
+#define STOCKFISH_H_INCLUDED
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A move is encoded as in the engine: bits 0-5 are the destination square,
+   bits 6-11 the origin square (a1 = 0, b1 = 1, ..., h8 = 63), bits 12-13 the
+   promotion piece type minus 2 (knight = 0 ... queen = 3) and bits 14-15 the
+   special move flag (1 promotion, 2 en passant, 3 castling). Zero means no
+   move. Castling is encoded as "king captures rook". */
+typedef uint16_t sf_move;
+
+/* An engine owns its threads, transposition table and search state */
+typedef struct sf_engine sf_engine;
+
+/* Search limits, zero means not set. Times are in milliseconds, side 0 is
+   white and 1 is black. With no limit set the search is infinite and must be
+   stopped with sf_stop(). */
+typedef struct {
+  int time[2], inc[2], movestogo;
+  int depth, nodes, movetime, mate;
+} sf_limits;
+
+enum { SF_BOUND_EXACT, SF_BOUND_LOWER, SF_BOUND_UPPER };
+
+/* A PV line, as reported at the end of each iteration. Score is from the
+   side to move point of view, in centipawns or in moves to mate if 'mate' is
+   set (negative if getting mated). 'pv' is only valid during the callback. */
+typedef struct {
+  int depth, seldepth, multipv;
+  int score, mate, bound;
+  uint64_t nodes;
+  int time;
+  const sf_move* pv;
+  int pvLength;
+} sf_info;
+
+typedef void (*sf_info_callback)(const sf_info* info, void* data);
+
+/* Initializes the lookup tables shared by all the engines. Must be called
+   once, before any other function. */
+void sf_init(void);
+
+/* Sets a UCI option common to all the engines, like "MultiPV", "Contempt"
+   or "UCI_Chess960". Threads and hash sizes are set per engine instead.
+   The options are process-wide and read by all the running searches, so
+   they can be set only while no engine is searching. Returns 0 on success,
+   -1 if the option does not exist and -2 if a search is running. */
+int sf_set_option(const char* name, const char* value);
+
+/* Creates an engine with the given number of threads and hash size in MB,
+   set to the start position. */
+sf_engine* sf_engine_new(int threads, int hashMb);
+void sf_engine_delete(sf_engine* e);
+void sf_clear_hash(sf_engine* e);
+
+/* Sets the size in MB of the evaluation cache of each thread of the engine,
+   0 disables it. The default is the "Eval Hash" option, off by default. */
+void sf_set_eval_hash(sf_engine* e, int mb);
+
+/* Sets the position from a FEN string, or the start position if NULL, then
+   plays the space separated moves in UCI notation, if any. Returns 0 on
+   success and -1 if a move is illegal, leaving the engine position as it
+   was. */
+int sf_set_position(sf_engine* e, const char* fen, const char* moves);
+
+/* Searches the current position and returns the best move, and the ponder
+   move if 'ponder' is not NULL. Blocks until the search is finished. The
+   callback, if not NULL, is called by the search thread with each PV line. */
+sf_move sf_search(sf_engine* e, const sf_limits* limits,
+                  sf_info_callback callback, void* data, sf_move* ponder);
+
+/* Stops the running search of the engine, can be called from any thread */
+void sf_stop(sf_engine* e);
+
+/* Static evaluation of the current position in centipawns, from the side to
+   move point of view. Returns -1 if the side to move is in check, when the
+   evaluation is not defined. Must not be called while searching. */
+int sf_eval(sf_engine* e, int* score);
+
+/* Number of leaf nodes of the legal move tree of the given depth */
+uint64_t sf_perft(sf_engine* e, int depth);
+
+/* Writes the move in UCI notation to 'buf', of the given size. Returns the
+   length of the string, or -1 if it does not fit. */
+int sf_move_to_uci(sf_engine* e, sf_move m, char* buf, int size);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* #ifndef STOCKFISH_H_INCLUDED */
@@ -0,0 +1,818 @@
+// Generated by gentables, do not edit
+
+#include "tables.h"
+
+namespace Tables {
+
+const bool Precomputed = true;
+
+const Bitboard RookMagics[SQUARE_NB] = {
+  0x008000400020801aULL, 0x0840004020001003ULL, 0x8880200010018108ULL, 0x0480040800801001ULL,
+  0x0900080002050010ULL, 0x0200100804010200ULL, 0x0200010084080200ULL, 0x0200024100821224ULL,
+  0x08a0802080004000ULL, 0x0006401004402000ULL, 0x0800802000100080ULL, 0x4004800803100081ULL,
+  0x0106000810200600ULL, 0x2981000802040100ULL, 0x0004000804018210ULL, 0x0201000192026300ULL,
+  0x1038218000804000ULL, 0x1010004000200040ULL, 0x0108420012002881ULL, 0x2098008008100080ULL,
+  0x4088010004090010ULL, 0x2000808002000400ULL, 0x028a0c0008021025ULL, 0x0000220000810064ULL,
+  0x0040400480208000ULL, 0x8040200040100042ULL, 0x2000100080802000ULL, 0x3090004040080401ULL,
+  0x0100080080800400ULL, 0x8230020080800400ULL, 0x0002000200080104ULL, 0x0c00010200004084ULL,
+  0x0000400082800020ULL, 0x0400200080804007ULL, 0x8400801000802001ULL, 0x0018100080800800ULL,
+  0x0810310005004800ULL, 0x8000020080800400ULL, 0x2000302134000208ULL, 0x0000298402000645ULL,
+  0x0000800140018022ULL, 0x00184020100c4000ULL, 0x6210002804002000ULL, 0x0001000c10010020ULL,
+  0x4201000800110004ULL, 0x2002000810020004ULL, 0xa40c21480a040090ULL, 0x0000004081020004ULL,
+  0x3302410080002300ULL, 0x9210002000401040ULL, 0x0092110041200300ULL, 0x0100100109002300ULL,
+  0x000a800800240280ULL, 0x0100040080020080ULL, 0x0000506201080400ULL, 0x1002209110440600ULL,
+  0x0140800300182241ULL, 0x8280184280220102ULL, 0x0005118042000a22ULL, 0x008a000890204006ULL,
+  0x000200304844204aULL, 0x108200080930041aULL, 0x0482000100840842ULL, 0x0012192404430182ULL
+};
+
+const Bitboard BishopMagics[SQUARE_NB] = {
+  0x4404700420508600ULL, 0x9120018401104008ULL, 0x4004010401100084ULL, 0x0051040080062000ULL,
+  0x1124042010010092ULL, 0x1100882108001000ULL, 0x180a280248040000ULL, 0x0038440210900400ULL,
+  0x80074210e1010301ULL, 0x0020101012004e42ULL, 0x8210100110411001ULL, 0x00008404108010a0ULL,
+  0x2060071040002804ULL, 0x6400020202211011ULL, 0x000c0d0111202000ULL, 0x8004050118020221ULL,
+  0x8005804088080910ULL, 0x6004a82001020200ULL, 0x0101001004002041ULL, 0x8a1800a082004282ULL,
+  0x8806001012100098ULL, 0x0022810040504000ULL, 0x4040800048480801ULL, 0x0a42041304824120ULL,
+  0x0204106085200814ULL, 0x0890110682040111ULL, 0x4000500001040080ULL, 0x0000808018020102ULL,
+  0x2401010010104008ULL, 0x1052008004100080ULL, 0x0000950104090801ULL, 0x1200808000220864ULL,
+  0x8188421201082050ULL, 0x0035011001a05c00ULL, 0x0051480201104400ULL, 0x4110040400180210ULL,
+  0x0414140400001100ULL, 0x4e60008100688040ULL, 0x000121022ac40200ULL, 0x00040042904a0094ULL,
+  0x2948010421001040ULL, 0x4060821011020200ULL, 0x0001004030008202ULL, 0x0018020122080401ULL,
+  0x0042ca41a2000400ULL, 0x01c0212040810100ULL, 0x1060480f41020041ULL, 0x020102020a040040ULL,
+  0x1082008220100402ULL, 0x0102020202828102ULL, 0x4022108848080004ULL, 0x0020400508480000ULL,
+  0x1010108590440010ULL, 0xd812040810a10140ULL, 0x0191043000a20038ULL, 0x8010020200620000ULL,
+  0x0001008801084280ULL, 0x0000060882015050ULL, 0x8120000100809001ULL, 0x0200100002104420ULL,
+  0x10d100200821010aULL, 0x03002c0448100110ULL, 0x14004005045c0042ULL, 0x4002901008831040ULL
+};
+
+const uint32_t KPKBitbase[KPKBitbaseSize] = {
+  0xfffffcfc, 0xfffeffff, 0xfffff8f8, 0xfffeffff, 0xfffff1f1, 0xfffeffff, 0xffffe3e3, 0xfffeffff,
+  0xffffc7c7, 0xfffeffff, 0xffff8f8f, 0xfffeffff, 0xffff1f1f, 0xfffeffff, 0xffff3f3f, 0xfffeffff,
+  0xfffcfcfc, 0xfffeffff, 0xfff8f8f8, 0xfffeffff, 0xfff1f1f1, 0xfffeffff, 0xffe3e3e3, 0xfffeffff,
+  0xffc7c7c7, 0xfffeffff, 0xff8f8f8f, 0xfffeffff, 0xff1f1f1f, 0xfffeffff, 0xff3f3f3f, 0xfffeffff,
+  0xfcfcfcff, 0xfffeffff, 0xf8f8f8ff, 0xfffeffff, 0xf1f1f1ff, 0xfffeffff, 0xe3e3e3ff, 0xfffeffff,
+  0xc7c7c7ff, 0xfffeffff, 0x8f8f8fff, 0xfffeffff, 0x1f1f1fff, 0xfffeffff, 0x3f3f3fff, 0xfffeffff,
+  0xfcfcffff, 0xfffefffc, 0xf8f8ffff, 0xfffefff8, 0xf1f1ffff, 0xfffefff1, 0xe3e3ffff, 0xfffeffe3,
+  0xc7c7ffff, 0xfffeffc7, 0x8f8fffff, 0xfffeff8f, 0x1f1fffff, 0xfffeff1f, 0x3f3fffff, 0xfffeff3f,
+  0xfcffffff, 0xfffefcfc, 0xf8ffffff, 0xfffef8f8, 0xf1ffffff, 0xfffef1f1, 0xe3ffffff, 0xfffee3e3,
+  0xc7ffffff, 0xfffec7c7, 0x8fffffff, 0xfffe8f8f, 0x1fffffff, 0xfffe1f1f, 0x3fffffff, 0xfffe3f3f,
+  0xffffffff, 0xfffcfcfc, 0xffffffff, 0xfff8f8f8, 0xffffffff, 0xfff0f1f1, 0xffffffff, 0xffe2e3e3,
+  0xffffffff, 0xffc6c7c7, 0xffffffff, 0xff8e8f8f, 0xffffffff, 0xff1e1f1f, 0xffffffff, 0xff3e3f3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xf0f0f1ff, 0xffffffff, 0xe3e2e3ff,
+  0xffffffff, 0xc7c6c7ff, 0xffffffff, 0x8f8e8fff, 0xffffffff, 0x1f1e1fff, 0xffffffff, 0x3f3e3fff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xf0f0ffff, 0xffffffff, 0xe3e2ffff,
+  0xffffffff, 0xc7c6ffff, 0xffffffff, 0x8f8effff, 0xffffffff, 0x1f1effff, 0xffffffff, 0x3f3effff,
+  0xfffffcfc, 0xfffeffff, 0xfffff8f8, 0xfffeffff, 0xfffff1f1, 0xfffeffff, 0xffffe3e3, 0xfffeffff,
+  0xffffc7c7, 0xfffeffff, 0xffff8f8f, 0xfffeffff, 0xffff1f1f, 0xfffeffff, 0xffff3f3f, 0xfffeffff,
+  0xfffcfcfc, 0xfffeffff, 0xfff8f8f8, 0xfffeffff, 0xfff1f1f1, 0xfffeffff, 0xffe3e3e3, 0xfffeffff,
+  0xffc7c7c7, 0xfffeffff, 0xff8f8f8f, 0xfffeffff, 0xff1f1f1f, 0xfffeffff, 0xff3f3f3f, 0xfffeffff,
+  0xfcfcfcff, 0xfffeffff, 0xf8f8f8ff, 0xfffeffff, 0xf1f1f1ff, 0xfffeffff, 0xe3e3e3ff, 0xfffeffff,
+  0xc7c7c7ff, 0xfffeffff, 0x8f8f8fff, 0xfffeffff, 0x1f1f1fff, 0xfffeffff, 0x3f3f3fff, 0xfffeffff,
+  0xfcfcffff, 0xfffefffc, 0xf8f8ffff, 0xfffefff8, 0xf1f1ffff, 0xfffefff1, 0xe3e3ffff, 0xfffeffe3,
+  0xc7c7ffff, 0xfffeffc7, 0x8f8fffff, 0xfffeff8f, 0x1f1fffff, 0xfffeff1f, 0x3f3fffff, 0xfffeff3f,
+  0xfcffffff, 0xfffefcfc, 0xf8ffffff, 0xfffef8f8, 0xf1ffffff, 0xfffef1f1, 0xe3ffffff, 0xfffee3e3,
+  0xc7ffffff, 0xfffec7c7, 0x8fffffff, 0xfffe8f8f, 0x1fffffff, 0xfffe1f1f, 0x3fffffff, 0xfffe3f3f,
+  0x00000000, 0x03000000, 0x00000000, 0x02000000, 0x00000000, 0x06000100, 0xffffffff, 0xfee2e3e3,
+  0xffffffff, 0xffc6c7c7, 0xffffffff, 0xff8e8f8f, 0xffffffff, 0xff1e1f1f, 0xffffffff, 0xff3e3f3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000100, 0xffffffff, 0xe2e2e3ff,
+  0xffffffff, 0xc7c6c7ff, 0xffffffff, 0x8f8e8fff, 0xffffffff, 0x1f1e1fff, 0xffffffff, 0x3f3e3fff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000700, 0xffffffff, 0xe2e2ffff,
+  0xffffffff, 0xc7c6ffff, 0xffffffff, 0x8f8effff, 0xffffffff, 0x1f1effff, 0xffffffff, 0x3f3effff,
+  0xfffffcfc, 0xfffdffff, 0xfffff8f8, 0xfffdffff, 0xfffff1f1, 0xfffdffff, 0xffffe3e3, 0xfffdffff,
+  0xffffc7c7, 0xfffdffff, 0xffff8f8f, 0xfffdffff, 0xffff1f1f, 0xfffdffff, 0xffff3f3f, 0xfffdffff,
+  0xfffcfcfc, 0xfffdffff, 0xfff8f8f8, 0xfffdffff, 0xfff1f1f1, 0xfffdffff, 0xffe3e3e3, 0xfffdffff,
+  0xffc7c7c7, 0xfffdffff, 0xff8f8f8f, 0xfffdffff, 0xff1f1f1f, 0xfffdffff, 0xff3f3f3f, 0xfffdffff,
+  0xfcfcfcff, 0xfffdffff, 0xf8f8f8ff, 0xfffdffff, 0xf1f1f1ff, 0xfffdffff, 0xe3e3e3ff, 0xfffdffff,
+  0xc7c7c7ff, 0xfffdffff, 0x8f8f8fff, 0xfffdffff, 0x1f1f1fff, 0xfffdffff, 0x3f3f3fff, 0xfffdffff,
+  0xfcfcffff, 0xfffdfffc, 0xf8f8ffff, 0xfffdfff8, 0xf1f1ffff, 0xfffdfff1, 0xe3e3ffff, 0xfffdffe3,
+  0xc7c7ffff, 0xfffdffc7, 0x8f8fffff, 0xfffdff8f, 0x1f1fffff, 0xfffdff1f, 0x3f3fffff, 0xfffdff3f,
+  0xfcffffff, 0xfffdfcfc, 0xf8ffffff, 0xfffdf8f8, 0xf1ffffff, 0xfffdf1f1, 0xe3ffffff, 0xfffde3e3,
+  0xc7ffffff, 0xfffdc7c7, 0x8fffffff, 0xfffd8f8f, 0x1fffffff, 0xfffd1f1f, 0x3fffffff, 0xfffd3f3f,
+  0xffffffff, 0xfffcfcfc, 0xffffffff, 0xfff8f8f8, 0xffffffff, 0xfff1f1f1, 0xffffffff, 0xffe1e3e3,
+  0xffffffff, 0xffc5c7c7, 0xffffffff, 0xff8d8f8f, 0xffffffff, 0xff1d1f1f, 0xffffffff, 0xff3d3f3f,
+  0x00000000, 0x0c0c0c00, 0x00000000, 0x00000000, 0x00000000, 0x01010100, 0xffffffff, 0xe3e1e3ff,
+  0xffffffff, 0xc7c5c7ff, 0xffffffff, 0x8f8d8fff, 0xffffffff, 0x1f1d1fff, 0xffffffff, 0x3f3d3fff,
+  0x00000000, 0x00000000, 0x00000000, 0x00080a0f, 0x00000000, 0x00000000, 0xffffffff, 0xe3e1ffff,
+  0xffffffff, 0xc7c5ffff, 0xffffffff, 0x8f8dffff, 0xffffffff, 0x1f1dffff, 0xffffffff, 0x3f3dffff,
+  0xfffffcfc, 0xfffdffff, 0xfffff8f8, 0xfffdffff, 0xfffff1f1, 0xfffdffff, 0xffffe3e3, 0xfffdffff,
+  0xffffc7c7, 0xfffdffff, 0xffff8f8f, 0xfffdffff, 0xffff1f1f, 0xfffdffff, 0xffff3f3f, 0xfffdffff,
+  0xfffcfcfc, 0xfffdffff, 0xfff8f8f8, 0xfffdffff, 0xfff1f1f1, 0xfffdffff, 0xffe3e3e3, 0xfffdffff,
+  0xffc7c7c7, 0xfffdffff, 0xff8f8f8f, 0xfffdffff, 0xff1f1f1f, 0xfffdffff, 0xff3f3f3f, 0xfffdffff,
+  0xfcfcfcff, 0xfffdffff, 0xf8f8f8ff, 0xfffdffff, 0xf1f1f1ff, 0xfffdffff, 0xe3e3e3ff, 0xfffdffff,
+  0xc7c7c7ff, 0xfffdffff, 0x8f8f8fff, 0xfffdffff, 0x1f1f1fff, 0xfffdffff, 0x3f3f3fff, 0xfffdffff,
+  0xfcfcffff, 0xfffdfffc, 0xf8f8ffff, 0xfffdfff8, 0xf1f1ffff, 0xfffdfff1, 0xe3e3ffff, 0xfffdffe3,
+  0xc7c7ffff, 0xfffdffc7, 0x8f8fffff, 0xfffdff8f, 0x1f1fffff, 0xfffdff1f, 0x3f3fffff, 0xfffdff3f,
+  0xfcffffff, 0xfffdfcfc, 0xf8ffffff, 0xfffdf8f8, 0xf1ffffff, 0xfffdf1f1, 0xe3ffffff, 0xfffde3e3,
+  0xc7ffffff, 0xfffdc7c7, 0x8fffffff, 0xfffd8f8f, 0x1fffffff, 0xfffd1f1f, 0x3fffffff, 0xfffd3f3f,
+  0x00000000, 0x07040400, 0x00000000, 0x07000000, 0x00000000, 0x07010100, 0x00000000, 0x0f010300,
+  0xffffffff, 0xffc5c7c7, 0xffffffff, 0xff8d8f8f, 0xffffffff, 0xff1d1f1f, 0xffffffff, 0xff3d3f3f,
+  0x00000000, 0x04040000, 0x00000000, 0x00000000, 0x00000000, 0x01010000, 0x00000000, 0x03010300,
+  0xffffffff, 0xc7c5c7ff, 0xffffffff, 0x8f8d8fff, 0xffffffff, 0x1f1d1fff, 0xffffffff, 0x3f3d3fff,
+  0x00000000, 0x04040200, 0x00000000, 0x00000500, 0x00000000, 0x01010200, 0x00000000, 0x03010f00,
+  0xffffffff, 0xc7c5ffff, 0xffffffff, 0x8f8dffff, 0xffffffff, 0x1f1dffff, 0xffffffff, 0x3f3dffff,
+  0xfffffcfc, 0xfffbffff, 0xfffff8f8, 0xfffbffff, 0xfffff1f1, 0xfffbffff, 0xffffe3e3, 0xfffbffff,
+  0xffffc7c7, 0xfffbffff, 0xffff8f8f, 0xfffbffff, 0xffff1f1f, 0xfffbffff, 0xffff3f3f, 0xfffbffff,
+  0xfffcfcfc, 0xfffbffff, 0xfff8f8f8, 0xfffbffff, 0xfff1f1f1, 0xfffbffff, 0xffe3e3e3, 0xfffbffff,
+  0xffc7c7c7, 0xfffbffff, 0xff8f8f8f, 0xfffbffff, 0xff1f1f1f, 0xfffbffff, 0xff3f3f3f, 0xfffbffff,
+  0xfcfcfcff, 0xfffbffff, 0xf8f8f8ff, 0xfffbffff, 0xf1f1f1ff, 0xfffbffff, 0xe3e3e3ff, 0xfffbffff,
+  0xc7c7c7ff, 0xfffbffff, 0x8f8f8fff, 0xfffbffff, 0x1f1f1fff, 0xfffbffff, 0x3f3f3fff, 0xfffbffff,
+  0xfcfcffff, 0xfffbfffc, 0xf8f8ffff, 0xfffbfff8, 0xf1f1ffff, 0xfffbfff1, 0xe3e3ffff, 0xfffbffe3,
+  0xc7c7ffff, 0xfffbffc7, 0x8f8fffff, 0xfffbff8f, 0x1f1fffff, 0xfffbff1f, 0x3f3fffff, 0xfffbff3f,
+  0xfcffffff, 0xfffbfcfc, 0xf8ffffff, 0xfffbf8f8, 0xf1ffffff, 0xfffbf1f1, 0xe3ffffff, 0xfffbe3e3,
+  0xc7ffffff, 0xfffbc7c7, 0x8fffffff, 0xfffb8f8f, 0x1fffffff, 0xfffb1f1f, 0x3fffffff, 0xfffb3f3f,
+  0xffffffff, 0xfff8fcfc, 0xffffffff, 0xfff8f8f8, 0xffffffff, 0xfff1f1f1, 0xffffffff, 0xffe3e3e3,
+  0xffffffff, 0xffc3c7c7, 0xffffffff, 0xff8b8f8f, 0xffffffff, 0xff1b1f1f, 0xffffffff, 0xff3b3f3f,
+  0xffffffff, 0xfcf8fcff, 0x00000000, 0x18181800, 0x00000000, 0x00000000, 0x00000000, 0x03030300,
+  0xffffffff, 0xc7c3c7ff, 0xffffffff, 0x8f8b8fff, 0xffffffff, 0x1f1b1fff, 0xffffffff, 0x3f3b3fff,
+  0xffffffff, 0xfcf8ffff, 0x00000000, 0x00000000, 0x00000000, 0x0011151f, 0x00000000, 0x00000000,
+  0xffffffff, 0xc7c3ffff, 0xffffffff, 0x8f8bffff, 0xffffffff, 0x1f1bffff, 0xffffffff, 0x3f3bffff,
+  0xfffffcfc, 0xfffbffff, 0xfffff8f8, 0xfffbffff, 0xfffff1f1, 0xfffbffff, 0xffffe3e3, 0xfffbffff,
+  0xffffc7c7, 0xfffbffff, 0xffff8f8f, 0xfffbffff, 0xffff1f1f, 0xfffbffff, 0xffff3f3f, 0xfffbffff,
+  0xfffcfcfc, 0xfffbffff, 0xfff8f8f8, 0xfffbffff, 0xfff1f1f1, 0xfffbffff, 0xffe3e3e3, 0xfffbffff,
+  0xffc7c7c7, 0xfffbffff, 0xff8f8f8f, 0xfffbffff, 0xff1f1f1f, 0xfffbffff, 0xff3f3f3f, 0xfffbffff,
+  0xfcfcfcff, 0xfffbffff, 0xf8f8f8ff, 0xfffbffff, 0xf1f1f1ff, 0xfffbffff, 0xe3e3e3ff, 0xfffbffff,
+  0xc7c7c7ff, 0xfffbffff, 0x8f8f8fff, 0xfffbffff, 0x1f1f1fff, 0xfffbffff, 0x3f3f3fff, 0xfffbffff,
+  0xfcfcffff, 0xfffbfffc, 0xf8f8ffff, 0xfffbfff8, 0xf1f1ffff, 0xfffbfff1, 0xe3e3ffff, 0xfffbffe3,
+  0xc7c7ffff, 0xfffbffc7, 0x8f8fffff, 0xfffbff8f, 0x1f1fffff, 0xfffbff1f, 0x3f3fffff, 0xfffbff3f,
+  0xfcffffff, 0xfffbfcfc, 0xf8ffffff, 0xfffbf8f8, 0xf1ffffff, 0xfffbf1f1, 0xe3ffffff, 0xfffbe3e3,
+  0xc7ffffff, 0xfffbc7c7, 0x8fffffff, 0xfffb8f8f, 0x1fffffff, 0xfffb1f1f, 0x3fffffff, 0xfffb3f3f,
+  0x00000000, 0x1f181c00, 0x00000000, 0x0e080800, 0x00000000, 0x0e000000, 0x00000000, 0x0e020200,
+  0x00000000, 0x1f030700, 0xffffffff, 0xff8b8f8f, 0xffffffff, 0xff1b1f1f, 0xffffffff, 0xff3b3f3f,
+  0x00000000, 0x1c181c00, 0x00000000, 0x08080000, 0x00000000, 0x00000000, 0x00000000, 0x02020000,
+  0x00000000, 0x07030700, 0xffffffff, 0x8f8b8fff, 0xffffffff, 0x1f1b1fff, 0xffffffff, 0x3f3b3fff,
+  0x00000000, 0x1c181c00, 0x00000000, 0x08080400, 0x00000000, 0x00000a00, 0x00000000, 0x02020400,
+  0x00000000, 0x07031f00, 0xffffffff, 0x8f8bffff, 0xffffffff, 0x1f1bffff, 0xffffffff, 0x3f3bffff,
+  0xfffffcfc, 0xfff7ffff, 0xfffff8f8, 0xfff7ffff, 0xfffff1f1, 0xfff7ffff, 0xffffe3e3, 0xfff7ffff,
+  0xffffc7c7, 0xfff7ffff, 0xffff8f8f, 0xfff7ffff, 0xffff1f1f, 0xfff7ffff, 0xffff3f3f, 0xfff7ffff,
+  0xfffcfcfc, 0xfff7ffff, 0xfff8f8f8, 0xfff7ffff, 0xfff1f1f1, 0xfff7ffff, 0xffe3e3e3, 0xfff7ffff,
+  0xffc7c7c7, 0xfff7ffff, 0xff8f8f8f, 0xfff7ffff, 0xff1f1f1f, 0xfff7ffff, 0xff3f3f3f, 0xfff7ffff,
+  0xfcfcfcff, 0xfff7ffff, 0xf8f8f8ff, 0xfff7ffff, 0xf1f1f1ff, 0xfff7ffff, 0xe3e3e3ff, 0xfff7ffff,
+  0xc7c7c7ff, 0xfff7ffff, 0x8f8f8fff, 0xfff7ffff, 0x1f1f1fff, 0xfff7ffff, 0x3f3f3fff, 0xfff7ffff,
+  0xfcfcffff, 0xfff7fffc, 0xf8f8ffff, 0xfff7fff8, 0xf1f1ffff, 0xfff7fff1, 0xe3e3ffff, 0xfff7ffe3,
+  0xc7c7ffff, 0xfff7ffc7, 0x8f8fffff, 0xfff7ff8f, 0x1f1fffff, 0xfff7ff1f, 0x3f3fffff, 0xfff7ff3f,
+  0xfcffffff, 0xfff7fcfc, 0xf8ffffff, 0xfff7f8f8, 0xf1ffffff, 0xfff7f1f1, 0xe3ffffff, 0xfff7e3e3,
+  0xc7ffffff, 0xfff7c7c7, 0x8fffffff, 0xfff78f8f, 0x1fffffff, 0xfff71f1f, 0x3fffffff, 0xfff73f3f,
+  0xffffffff, 0xfff4fcfc, 0xffffffff, 0xfff0f8f8, 0xffffffff, 0xfff1f1f1, 0xffffffff, 0xffe3e3e3,
+  0xffffffff, 0xffc7c7c7, 0xffffffff, 0xff878f8f, 0xffffffff, 0xff171f1f, 0xffffffff, 0xff373f3f,
+  0xffffffff, 0xfcf4fcff, 0xffffffff, 0xf8f0f8ff, 0x00000000, 0x30303000, 0x00000000, 0x00000000,
+  0x00000000, 0x06060600, 0xffffffff, 0x8f878fff, 0xffffffff, 0x1f171fff, 0xffffffff, 0x3f373fff,
+  0xffffffff, 0xfcf4ffff, 0xffffffff, 0xf8f0ffff, 0x00000000, 0x00000000, 0x00000000, 0x00222a3e,
+  0x00000000, 0x00000000, 0xffffffff, 0x8f87ffff, 0xffffffff, 0x1f17ffff, 0xffffffff, 0x3f37ffff,
+  0xfffffcfc, 0xfff7ffff, 0xfffff8f8, 0xfff7ffff, 0xfffff1f1, 0xfff7ffff, 0xffffe3e3, 0xfff7ffff,
+  0xffffc7c7, 0xfff7ffff, 0xffff8f8f, 0xfff7ffff, 0xffff1f1f, 0xfff7ffff, 0xffff3f3f, 0xfff7ffff,
+  0xfffcfcfc, 0xfff7ffff, 0xfff8f8f8, 0xfff7ffff, 0xfff1f1f1, 0xfff7ffff, 0xffe3e3e3, 0xfff7ffff,
+  0xffc7c7c7, 0xfff7ffff, 0xff8f8f8f, 0xfff7ffff, 0xff1f1f1f, 0xfff7ffff, 0xff3f3f3f, 0xfff7ffff,
+  0xfcfcfcff, 0xfff7ffff, 0xf8f8f8ff, 0xfff7ffff, 0xf1f1f1ff, 0xfff7ffff, 0xe3e3e3ff, 0xfff7ffff,
+  0xc7c7c7ff, 0xfff7ffff, 0x8f8f8fff, 0xfff7ffff, 0x1f1f1fff, 0xfff7ffff, 0x3f3f3fff, 0xfff7ffff,
+  0xfcfcffff, 0xfff7fffc, 0xf8f8ffff, 0xfff7fff8, 0xf1f1ffff, 0xfff7fff1, 0xe3e3ffff, 0xfff7ffe3,
+  0xc7c7ffff, 0xfff7ffc7, 0x8f8fffff, 0xfff7ff8f, 0x1f1fffff, 0xfff7ff1f, 0x3f3fffff, 0xfff7ff3f,
+  0xfcffffff, 0xfff7fcfc, 0xf8ffffff, 0xfff7f8f8, 0xf1ffffff, 0xfff7f1f1, 0xe3ffffff, 0xfff7e3e3,
+  0xc7ffffff, 0xfff7c7c7, 0x8fffffff, 0xfff78f8f, 0x1fffffff, 0xfff71f1f, 0x3fffffff, 0xfff73f3f,
+  0xffffffff, 0xfff4fcfc, 0x00000000, 0x3e303800, 0x00000000, 0x1c101000, 0x00000000, 0x1c000000,
+  0x00000000, 0x1c040400, 0x00000000, 0x3e060e00, 0xffffffff, 0xff171f1f, 0xffffffff, 0xff373f3f,
+  0xffffffff, 0xfcf4fcff, 0x00000000, 0x38303800, 0x00000000, 0x10100000, 0x00000000, 0x00000000,
+  0x00000000, 0x04040000, 0x00000000, 0x0e060e00, 0xffffffff, 0x1f171fff, 0xffffffff, 0x3f373fff,
+  0xffffffff, 0xfcf4ffff, 0x00000000, 0x38303e00, 0x00000000, 0x10100800, 0x00000000, 0x00001400,
+  0x00000000, 0x04040800, 0x00000000, 0x0e063e00, 0xffffffff, 0x1f17ffff, 0xffffffff, 0x3f37ffff,
+  0xfffffcfc, 0xfffffeff, 0xfffff8f8, 0xfffffeff, 0xfffff1f1, 0xfffffeff, 0xffffe3e3, 0xfffffeff,
+  0xffffc7c7, 0xfffffeff, 0xffff8f8f, 0xfffffeff, 0xffff1f1f, 0xfffffeff, 0xffff3f3f, 0xfffffeff,
+  0xfffcfcfc, 0xfffffeff, 0xfff8f8f8, 0xfffffeff, 0xfff1f1f1, 0xfffffeff, 0xffe3e3e3, 0xfffffeff,
+  0xffc7c7c7, 0xfffffeff, 0xff8f8f8f, 0xfffffeff, 0xff1f1f1f, 0xfffffeff, 0xff3f3f3f, 0xfffffeff,
+  0xfcfcfcff, 0xfffffeff, 0xf8f8f8ff, 0xfffffeff, 0xf1f1f1ff, 0xfffffeff, 0xe3e3e3ff, 0xfffffeff,
+  0xc7c7c7ff, 0xfffffeff, 0x8f8f8fff, 0xfffffeff, 0x1f1f1fff, 0xfffffeff, 0x3f3f3fff, 0xfffffeff,
+  0xfcfcffff, 0xfffffefc, 0xf8f8ffff, 0xfffffef8, 0xf1f1ffff, 0xfffffef1, 0xe3e3ffff, 0xfffffee3,
+  0xc7c7ffff, 0xfffffec7, 0x8f8fffff, 0xfffffe8f, 0x1f1fffff, 0xfffffe1f, 0x3f3fffff, 0xfffffe3f,
+  0xfcffffff, 0xfffffcfc, 0xf8ffffff, 0xfffff8f8, 0xf1ffffff, 0xfffff0f1, 0xe3ffffff, 0xffffe2e3,
+  0xc7ffffff, 0xffffc6c7, 0x8fffffff, 0xffff8e8f, 0x1fffffff, 0xffff1e1f, 0x3fffffff, 0xffff3e3f,
+  0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x00000000, 0x07010000, 0xffffffff, 0xffe3e2e3,
+  0xffffffff, 0xffc7c6c7, 0xffffffff, 0xff8f8e8f, 0xffffffff, 0xff1f1e1f, 0xffffffff, 0xff3f3e3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xe3e3e2ff,
+  0xffffffff, 0xc7c7c6ff, 0xffffffff, 0x8f8f8eff, 0xffffffff, 0x1f1f1eff, 0xffffffff, 0x3f3f3eff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000600, 0xffffffff, 0xe3e3feff,
+  0xffffffff, 0xc7c7feff, 0xffffffff, 0x8f8ffeff, 0xffffffff, 0x1f1ffeff, 0xffffffff, 0x3f3ffeff,
+  0xfffffcfc, 0xfffffeff, 0xfffff8f8, 0xfffffeff, 0xfffff1f1, 0xfffffeff, 0xffffe3e3, 0xfffffeff,
+  0xffffc7c7, 0xfffffeff, 0xffff8f8f, 0xfffffeff, 0xffff1f1f, 0xfffffeff, 0xffff3f3f, 0xfffffeff,
+  0xfffcfcfc, 0xfffffeff, 0xfff8f8f8, 0xfffffeff, 0xfff1f1f1, 0xfffffeff, 0xffe3e3e3, 0xfffffeff,
+  0xffc7c7c7, 0xfffffeff, 0xff8f8f8f, 0xfffffeff, 0xff1f1f1f, 0xfffffeff, 0xff3f3f3f, 0xfffffeff,
+  0xfcfcfcff, 0xfffffeff, 0xf8f8f8ff, 0xfffffeff, 0xf1f1f1ff, 0xfffffeff, 0xe3e3e3ff, 0xfffffeff,
+  0xc7c7c7ff, 0xfffffeff, 0x8f8f8fff, 0xfffffeff, 0x1f1f1fff, 0xfffffeff, 0x3f3f3fff, 0xfffffeff,
+  0xfcfcffff, 0xfffffefc, 0xf8f8ffff, 0xfffffef8, 0xf1f1ffff, 0xfffffef1, 0xe3e3ffff, 0xfffffee3,
+  0xc7c7ffff, 0xfffffec7, 0x8f8fffff, 0xfffffe8f, 0x1f1fffff, 0xfffffe1f, 0x3f3fffff, 0xfffffe3f,
+  0x00000000, 0x00030000, 0x00000000, 0x00030000, 0x00000000, 0x02070000, 0x00000000, 0x070f0202,
+  0xc7ffffff, 0xffffc6c7, 0x8fffffff, 0xffff8e8f, 0x1fffffff, 0xffff1e1f, 0x3fffffff, 0xffff3e3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x00000000, 0x06020200,
+  0xffffffff, 0xffc7c6c7, 0xffffffff, 0xff8f8e8f, 0xffffffff, 0xff1f1e1f, 0xffffffff, 0xff3f3e3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02020200,
+  0xffffffff, 0xc7c7c6ff, 0xffffffff, 0x8f8f8eff, 0xffffffff, 0x1f1f1eff, 0xffffffff, 0x3f3f3eff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02020600,
+  0xffffffff, 0xc7c7feff, 0xffffffff, 0x8f8ffeff, 0xffffffff, 0x1f1ffeff, 0xffffffff, 0x3f3ffeff,
+  0xfffffcfc, 0xfffffdff, 0xfffff8f8, 0xfffffdff, 0xfffff1f1, 0xfffffdff, 0xffffe3e3, 0xfffffdff,
+  0xffffc7c7, 0xfffffdff, 0xffff8f8f, 0xfffffdff, 0xffff1f1f, 0xfffffdff, 0xffff3f3f, 0xfffffdff,
+  0xfffcfcfc, 0xfffffdff, 0xfff8f8f8, 0xfffffdff, 0xfff1f1f1, 0xfffffdff, 0xffe3e3e3, 0xfffffdff,
+  0xffc7c7c7, 0xfffffdff, 0xff8f8f8f, 0xfffffdff, 0xff1f1f1f, 0xfffffdff, 0xff3f3f3f, 0xfffffdff,
+  0xfcfcfcff, 0xfffffdff, 0xf8f8f8ff, 0xfffffdff, 0xf1f1f1ff, 0xfffffdff, 0xe3e3e3ff, 0xfffffdff,
+  0xc7c7c7ff, 0xfffffdff, 0x8f8f8fff, 0xfffffdff, 0x1f1f1fff, 0xfffffdff, 0x3f3f3fff, 0xfffffdff,
+  0xfcfcffff, 0xfffffdfc, 0xf8f8ffff, 0xfffffdf8, 0xf1f1ffff, 0xfffffdf1, 0xe3e3ffff, 0xfffffde3,
+  0xc7c7ffff, 0xfffffdc7, 0x8f8fffff, 0xfffffd8f, 0x1f1fffff, 0xfffffd1f, 0x3f3fffff, 0xfffffd3f,
+  0xfcffffff, 0xfffffcfc, 0xf8ffffff, 0xfffff8f8, 0xf1ffffff, 0xfffff1f1, 0xe3ffffff, 0xffffe1e3,
+  0xc7ffffff, 0xffffc5c7, 0x8fffffff, 0xffff8d8f, 0x1fffffff, 0xffff1d1f, 0x3fffffff, 0xffff3d3f,
+  0x00000000, 0x0f0c0c0c, 0x00000000, 0x00000000, 0x00000000, 0x07010101, 0x07000000, 0x0f030103,
+  0xffffffff, 0xffc7c5c7, 0xffffffff, 0xff8f8d8f, 0xffffffff, 0xff1f1d1f, 0xffffffff, 0xff3f3d3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1f000000, 0x0303011f,
+  0xffffffff, 0xc7c7c5ff, 0xffffffff, 0x8f8f8dff, 0xffffffff, 0x1f1f1dff, 0xffffffff, 0x3f3f3dff,
+  0x00000000, 0x040c080f, 0x00000000, 0x00000500, 0x00000000, 0x0101090f, 0x1f000000, 0x03031d1f,
+  0xffffffff, 0xc7c7fdff, 0xffffffff, 0x8f8ffdff, 0xffffffff, 0x1f1ffdff, 0xffffffff, 0x3f3ffdff,
+  0xfffffcfc, 0xfffffdff, 0xfffff8f8, 0xfffffdff, 0xfffff1f1, 0xfffffdff, 0xffffe3e3, 0xfffffdff,
+  0xffffc7c7, 0xfffffdff, 0xffff8f8f, 0xfffffdff, 0xffff1f1f, 0xfffffdff, 0xffff3f3f, 0xfffffdff,
+  0xfffcfcfc, 0xfffffdff, 0xfff8f8f8, 0xfffffdff, 0xfff1f1f1, 0xfffffdff, 0xffe3e3e3, 0xfffffdff,
+  0xffc7c7c7, 0xfffffdff, 0xff8f8f8f, 0xfffffdff, 0xff1f1f1f, 0xfffffdff, 0xff3f3f3f, 0xfffffdff,
+  0xfcfcfcff, 0xfffffdff, 0xf8f8f8ff, 0xfffffdff, 0xf1f1f1ff, 0xfffffdff, 0xe3e3e3ff, 0xfffffdff,
+  0xc7c7c7ff, 0xfffffdff, 0x8f8f8fff, 0xfffffdff, 0x1f1f1fff, 0xfffffdff, 0x3f3f3fff, 0xfffffdff,
+  0xfcfcffff, 0xfffffdfc, 0xf8f8ffff, 0xfffffdf8, 0xf1f1ffff, 0xfffffdf1, 0xe3e3ffff, 0xfffffde3,
+  0xc7c7ffff, 0xfffffdc7, 0x8f8fffff, 0xfffffd8f, 0x1f1fffff, 0xfffffd1f, 0x3f3fffff, 0xfffffd3f,
+  0x00000000, 0x00070404, 0x00000000, 0x00070000, 0x00000000, 0x00070101, 0x00000000, 0x070f0103,
+  0x07000000, 0x0f1f0507, 0x8fffffff, 0xffff8d8f, 0x1fffffff, 0xffff1d1f, 0x3fffffff, 0xffff3d3f,
+  0x00000000, 0x00040400, 0x00000000, 0x00000000, 0x00000000, 0x00010100, 0x00000000, 0x07030103,
+  0x07000000, 0x0f070507, 0xffffffff, 0xff8f8d8f, 0xffffffff, 0xff1f1d1f, 0xffffffff, 0xff3f3d3f,
+  0x00000000, 0x00040000, 0x00000000, 0x00000000, 0x00000000, 0x00010100, 0x00000000, 0x0303010f,
+  0x07000000, 0x0707051f, 0xffffffff, 0x8f8f8dff, 0xffffffff, 0x1f1f1dff, 0xffffffff, 0x3f3f3dff,
+  0x00000000, 0x00000500, 0x00000000, 0x00000000, 0x00000000, 0x01010500, 0x00000000, 0x0303090f,
+  0x1f000000, 0x07071d1f, 0xffffffff, 0x8f8ffdff, 0xffffffff, 0x1f1ffdff, 0xffffffff, 0x3f3ffdff,
+  0xfffffcfc, 0xfffffbff, 0xfffff8f8, 0xfffffbff, 0xfffff1f1, 0xfffffbff, 0xffffe3e3, 0xfffffbff,
+  0xffffc7c7, 0xfffffbff, 0xffff8f8f, 0xfffffbff, 0xffff1f1f, 0xfffffbff, 0xffff3f3f, 0xfffffbff,
+  0xfffcfcfc, 0xfffffbff, 0xfff8f8f8, 0xfffffbff, 0xfff1f1f1, 0xfffffbff, 0xffe3e3e3, 0xfffffbff,
+  0xffc7c7c7, 0xfffffbff, 0xff8f8f8f, 0xfffffbff, 0xff1f1f1f, 0xfffffbff, 0xff3f3f3f, 0xfffffbff,
+  0xfcfcfcff, 0xfffffbff, 0xf8f8f8ff, 0xfffffbff, 0xf1f1f1ff, 0xfffffbff, 0xe3e3e3ff, 0xfffffbff,
+  0xc7c7c7ff, 0xfffffbff, 0x8f8f8fff, 0xfffffbff, 0x1f1f1fff, 0xfffffbff, 0x3f3f3fff, 0xfffffbff,
+  0xfcfcffff, 0xfffffbfc, 0xf8f8ffff, 0xfffffbf8, 0xf1f1ffff, 0xfffffbf1, 0xe3e3ffff, 0xfffffbe3,
+  0xc7c7ffff, 0xfffffbc7, 0x8f8fffff, 0xfffffb8f, 0x1f1fffff, 0xfffffb1f, 0x3f3fffff, 0xfffffb3f,
+  0xfcffffff, 0xfffff8fc, 0xf8ffffff, 0xfffff8f8, 0xf1ffffff, 0xfffff1f1, 0xe3ffffff, 0xffffe3e3,
+  0xc7ffffff, 0xffffc3c7, 0x8fffffff, 0xffff8b8f, 0x1fffffff, 0xffff1b1f, 0x3fffffff, 0xffff3b3f,
+  0x3e000000, 0x3f3c383c, 0x00000000, 0x1e181818, 0x00000000, 0x00000000, 0x00000000, 0x0f030303,
+  0x0f000000, 0x1f070307, 0xffffffff, 0xff8f8b8f, 0xffffffff, 0xff1f1b1f, 0xffffffff, 0xff3f3b3f,
+  0x3f000000, 0x3c3c383f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x3f000000, 0x0707033f, 0xffffffff, 0x8f8f8bff, 0xffffffff, 0x1f1f1bff, 0xffffffff, 0x3f3f3bff,
+  0x3f000000, 0x3c3c3b3f, 0x00000000, 0x1818191f, 0x00000000, 0x00000a00, 0x00000000, 0x0303131f,
+  0x3f000000, 0x07073b3f, 0xffffffff, 0x8f8ffbff, 0xffffffff, 0x1f1ffbff, 0xffffffff, 0x3f3ffbff,
+  0xfffffcfc, 0xfffffbff, 0xfffff8f8, 0xfffffbff, 0xfffff1f1, 0xfffffbff, 0xffffe3e3, 0xfffffbff,
+  0xffffc7c7, 0xfffffbff, 0xffff8f8f, 0xfffffbff, 0xffff1f1f, 0xfffffbff, 0xffff3f3f, 0xfffffbff,
+  0xfffcfcfc, 0xfffffbff, 0xfff8f8f8, 0xfffffbff, 0xfff1f1f1, 0xfffffbff, 0xffe3e3e3, 0xfffffbff,
+  0xffc7c7c7, 0xfffffbff, 0xff8f8f8f, 0xfffffbff, 0xff1f1f1f, 0xfffffbff, 0xff3f3f3f, 0xfffffbff,
+  0xfcfcfcff, 0xfffffbff, 0xf8f8f8ff, 0xfffffbff, 0xf1f1f1ff, 0xfffffbff, 0xe3e3e3ff, 0xfffffbff,
+  0xc7c7c7ff, 0xfffffbff, 0x8f8f8fff, 0xfffffbff, 0x1f1f1fff, 0xfffffbff, 0x3f3f3fff, 0xfffffbff,
+  0xfcfcffff, 0xfffffbfc, 0xf8f8ffff, 0xfffffbf8, 0xf1f1ffff, 0xfffffbf1, 0xe3e3ffff, 0xfffffbe3,
+  0xc7c7ffff, 0xfffffbc7, 0x8f8fffff, 0xfffffb8f, 0x1f1fffff, 0xfffffb1f, 0x3f3fffff, 0xfffffb3f,
+  0x00000000, 0x1e1f181c, 0x00000000, 0x000e0808, 0x00000000, 0x000e0000, 0x00000000, 0x000e0202,
+  0x00000000, 0x0f1f0307, 0x0f000000, 0x1f3f0b0f, 0x1fffffff, 0xffff1b1f, 0x3fffffff, 0xffff3b3f,
+  0x00000000, 0x1e1c181c, 0x00000000, 0x00080800, 0x00000000, 0x00000000, 0x00000000, 0x00020200,
+  0x00000000, 0x0f070307, 0x0f000000, 0x1f0f0b0f, 0xffffffff, 0xff1f1b1f, 0xffffffff, 0xff3f3b3f,
+  0x00000000, 0x1c1c181f, 0x00000000, 0x00080800, 0x00000000, 0x00000000, 0x00000000, 0x00020200,
+  0x00000000, 0x0707031f, 0x0f000000, 0x0f0f0b3f, 0xffffffff, 0x1f1f1bff, 0xffffffff, 0x3f3f3bff,
+  0x00000000, 0x1c1c191f, 0x00000000, 0x08080a00, 0x00000000, 0x00000000, 0x00000000, 0x02020a00,
+  0x00000000, 0x0707131f, 0x3f000000, 0x0f0f3b3f, 0xffffffff, 0x1f1ffbff, 0xffffffff, 0x3f3ffbff,
+  0xfffffcfc, 0xfffff7ff, 0xfffff8f8, 0xfffff7ff, 0xfffff1f1, 0xfffff7ff, 0xffffe3e3, 0xfffff7ff,
+  0xffffc7c7, 0xfffff7ff, 0xffff8f8f, 0xfffff7ff, 0xffff1f1f, 0xfffff7ff, 0xffff3f3f, 0xfffff7ff,
+  0xfffcfcfc, 0xfffff7ff, 0xfff8f8f8, 0xfffff7ff, 0xfff1f1f1, 0xfffff7ff, 0xffe3e3e3, 0xfffff7ff,
+  0xffc7c7c7, 0xfffff7ff, 0xff8f8f8f, 0xfffff7ff, 0xff1f1f1f, 0xfffff7ff, 0xff3f3f3f, 0xfffff7ff,
+  0xfcfcfcff, 0xfffff7ff, 0xf8f8f8ff, 0xfffff7ff, 0xf1f1f1ff, 0xfffff7ff, 0xe3e3e3ff, 0xfffff7ff,
+  0xc7c7c7ff, 0xfffff7ff, 0x8f8f8fff, 0xfffff7ff, 0x1f1f1fff, 0xfffff7ff, 0x3f3f3fff, 0xfffff7ff,
+  0xfcfcffff, 0xfffff7fc, 0xf8f8ffff, 0xfffff7f8, 0xf1f1ffff, 0xfffff7f1, 0xe3e3ffff, 0xfffff7e3,
+  0xc7c7ffff, 0xfffff7c7, 0x8f8fffff, 0xfffff78f, 0x1f1fffff, 0xfffff71f, 0x3f3fffff, 0xfffff73f,
+  0xfcffffff, 0xfffff4fc, 0xf8ffffff, 0xfffff0f8, 0xf1ffffff, 0xfffff1f1, 0xe3ffffff, 0xffffe3e3,
+  0xc7ffffff, 0xffffc7c7, 0x8fffffff, 0xffff878f, 0x1fffffff, 0xffff171f, 0x3fffffff, 0xffff373f,
+  0xffffffff, 0xfffcf4fc, 0x7c000000, 0x7e787078, 0x00000000, 0x3c303030, 0x00000000, 0x00000000,
+  0x00000000, 0x1e060606, 0x1f000000, 0x3f0f070f, 0xffffffff, 0xff1f171f, 0xffffffff, 0xff3f373f,
+  0xffffffff, 0xfcfcf4ff, 0x7f000000, 0x7878707f, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x7f000000, 0x0f0f077f, 0xffffffff, 0x1f1f17ff, 0xffffffff, 0x3f3f37ff,
+  0xffffffff, 0xfcfcf7ff, 0x7f000000, 0x7878777f, 0x00000000, 0x3030323e, 0x00000000, 0x00001400,
+  0x00000000, 0x0606263e, 0x7f000000, 0x0f0f777f, 0xffffffff, 0x1f1ff7ff, 0xffffffff, 0x3f3ff7ff,
+  0xfffffcfc, 0xfffff7ff, 0xfffff8f8, 0xfffff7ff, 0xfffff1f1, 0xfffff7ff, 0xffffe3e3, 0xfffff7ff,
+  0xffffc7c7, 0xfffff7ff, 0xffff8f8f, 0xfffff7ff, 0xffff1f1f, 0xfffff7ff, 0xffff3f3f, 0xfffff7ff,
+  0xfffcfcfc, 0xfffff7ff, 0xfff8f8f8, 0xfffff7ff, 0xfff1f1f1, 0xfffff7ff, 0xffe3e3e3, 0xfffff7ff,
+  0xffc7c7c7, 0xfffff7ff, 0xff8f8f8f, 0xfffff7ff, 0xff1f1f1f, 0xfffff7ff, 0xff3f3f3f, 0xfffff7ff,
+  0xfcfcfcff, 0xfffff7ff, 0xf8f8f8ff, 0xfffff7ff, 0xf1f1f1ff, 0xfffff7ff, 0xe3e3e3ff, 0xfffff7ff,
+  0xc7c7c7ff, 0xfffff7ff, 0x8f8f8fff, 0xfffff7ff, 0x1f1f1fff, 0xfffff7ff, 0x3f3f3fff, 0xfffff7ff,
+  0xfcfcffff, 0xfffff7fc, 0xf8f8ffff, 0xfffff7f8, 0xf1f1ffff, 0xfffff7f1, 0xe3e3ffff, 0xfffff7e3,
+  0xc7c7ffff, 0xfffff7c7, 0x8f8fffff, 0xfffff78f, 0x1f1fffff, 0xfffff71f, 0x3f3fffff, 0xfffff73f,
+  0x7c000000, 0x7e7f747c, 0x00000000, 0x3c3e3038, 0x00000000, 0x001c1010, 0x00000000, 0x001c0000,
+  0x00000000, 0x001c0404, 0x00000000, 0x1e3e060e, 0x1f000000, 0x3f7f171f, 0x3fffffff, 0xffff373f,
+  0x7c000000, 0x7e7c747c, 0x00000000, 0x3c383038, 0x00000000, 0x00101000, 0x00000000, 0x00000000,
+  0x00000000, 0x00040400, 0x00000000, 0x1e0e060e, 0x1f000000, 0x3f1f171f, 0xffffffff, 0xff3f373f,
+  0x7c000000, 0x7c7c747f, 0x00000000, 0x3838303e, 0x00000000, 0x00101000, 0x00000000, 0x00000000,
+  0x00000000, 0x00040400, 0x00000000, 0x0e0e063e, 0x1f000000, 0x1f1f177f, 0xffffffff, 0x3f3f37ff,
+  0x7f000000, 0x7c7c777f, 0x00000000, 0x3838323e, 0x00000000, 0x10101400, 0x00000000, 0x00000000,
+  0x00000000, 0x04041400, 0x00000000, 0x0e0e263e, 0x7f000000, 0x1f1f777f, 0xffffffff, 0x3f3ff7ff,
+  0xfffffcfc, 0xfffffffe, 0xfffff8f8, 0xfffffffe, 0xfffff1f1, 0xfffffffe, 0xffffe3e3, 0xfffffffe,
+  0xffffc7c7, 0xfffffffe, 0xffff8f8f, 0xfffffffe, 0xffff1f1f, 0xfffffffe, 0xffff3f3f, 0xfffffffe,
+  0xfffcfcfc, 0xfffffffe, 0xfff8f8f8, 0xfffffffe, 0xfff1f1f1, 0xfffffffe, 0xffe3e3e3, 0xfffffffe,
+  0xffc7c7c7, 0xfffffffe, 0xff8f8f8f, 0xfffffffe, 0xff1f1f1f, 0xfffffffe, 0xff3f3f3f, 0xfffffffe,
+  0xfcfcfcff, 0xfffffffe, 0xf8f8f8ff, 0xfffffffe, 0xf1f1f1ff, 0xfffffffe, 0xe3e3e3ff, 0xfffffffe,
+  0xc7c7c7ff, 0xfffffffe, 0x8f8f8fff, 0xfffffffe, 0x1f1f1fff, 0xfffffffe, 0x3f3f3fff, 0xfffffffe,
+  0xfcfcffff, 0xfffffffc, 0xf8f8ffff, 0xfffffff8, 0xf1f1ffff, 0xfffffff0, 0xe3e3ffff, 0xffffffe2,
+  0xc7c7ffff, 0xffffffc6, 0x8f8fffff, 0xffffff8e, 0x1f1fffff, 0xffffff1e, 0x3f3fffff, 0xffffff3e,
+  0x00000000, 0x00000000, 0x00000000, 0x00030000, 0x00000000, 0x07070100, 0x03000000, 0x0f0f0302,
+  0xc7ffffff, 0xffffc7c6, 0x8fffffff, 0xffff8f8e, 0x1fffffff, 0xffff1f1e, 0x3fffffff, 0xffff3f3e,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x00000000, 0x07030302,
+  0xffffffff, 0xffc7c7c6, 0xffffffff, 0xff8f8f8e, 0xffffffff, 0xff1f1f1e, 0xffffffff, 0xff3f3f3e,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03030300,
+  0xffffffff, 0xc7c7c7fe, 0xffffffff, 0x8f8f8ffe, 0xffffffff, 0x1f1f1ffe, 0xffffffff, 0x3f3f3ffe,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03030700,
+  0xffffffff, 0xc7c7fffe, 0xffffffff, 0x8f8ffffe, 0xffffffff, 0x1f1ffffe, 0xffffffff, 0x3f3ffffe,
+  0xfffffcfc, 0xfffffffe, 0xfffff8f8, 0xfffffffe, 0xfffff1f1, 0xfffffffe, 0xffffe3e3, 0xfffffffe,
+  0xffffc7c7, 0xfffffffe, 0xffff8f8f, 0xfffffffe, 0xffff1f1f, 0xfffffffe, 0xffff3f3f, 0xfffffffe,
+  0xfffcfcfc, 0xfffffffe, 0xfff8f8f8, 0xfffffffe, 0xfff1f1f1, 0xfffffffe, 0xffe3e3e3, 0xfffffffe,
+  0xffc7c7c7, 0xfffffffe, 0xff8f8f8f, 0xfffffffe, 0xff1f1f1f, 0xfffffffe, 0xff3f3f3f, 0xfffffffe,
+  0xfcfcfcff, 0xfffffffe, 0xf8f8f8ff, 0xfffffffe, 0xf1f1f1ff, 0xfffffffe, 0xe3e3e3ff, 0xfffffffe,
+  0xc7c7c7ff, 0xfffffffe, 0x8f8f8fff, 0xfffffffe, 0x1f1f1fff, 0xfffffffe, 0x3f3f3fff, 0xfffffffe,
+  0x00000000, 0x00000300, 0x00000000, 0x00000300, 0x00000000, 0x00030700, 0x02000000, 0x07070f02,
+  0x07000000, 0x0f0f1f06, 0x8f8fffff, 0xffffff8e, 0x1f1fffff, 0xffffff1e, 0x3f3fffff, 0xffffff3e,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000, 0x02060202,
+  0x00000000, 0x070f0706, 0x8fffffff, 0xffff8f8e, 0x1fffffff, 0xffff1f1e, 0x3fffffff, 0xffff3f3e,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02020200,
+  0x00000000, 0x07070700, 0xffffffff, 0xff8f8f8e, 0xffffffff, 0xff1f1f1e, 0xffffffff, 0xff3f3f3e,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02020000,
+  0x00000000, 0x07070700, 0xffffffff, 0x8f8f8ffe, 0xffffffff, 0x1f1f1ffe, 0xffffffff, 0x3f3f3ffe,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02020000,
+  0x00000000, 0x07070700, 0xffffffff, 0x8f8ffffe, 0xffffffff, 0x1f1ffffe, 0xffffffff, 0x3f3ffffe,
+  0xfffffcfc, 0xfffffffd, 0xfffff8f8, 0xfffffffd, 0xfffff1f1, 0xfffffffd, 0xffffe3e3, 0xfffffffd,
+  0xffffc7c7, 0xfffffffd, 0xffff8f8f, 0xfffffffd, 0xffff1f1f, 0xfffffffd, 0xffff3f3f, 0xfffffffd,
+  0xfffcfcfc, 0xfffffffd, 0xfff8f8f8, 0xfffffffd, 0xfff1f1f1, 0xfffffffd, 0xffe3e3e3, 0xfffffffd,
+  0xffc7c7c7, 0xfffffffd, 0xff8f8f8f, 0xfffffffd, 0xff1f1f1f, 0xfffffffd, 0xff3f3f3f, 0xfffffffd,
+  0xfcfcfcff, 0xfffffffd, 0xf8f8f8ff, 0xfffffffd, 0xf1f1f1ff, 0xfffffffd, 0xe3e3e3ff, 0xfffffffd,
+  0xc7c7c7ff, 0xfffffffd, 0x8f8f8fff, 0xfffffffd, 0x1f1f1fff, 0xfffffffd, 0x3f3f3fff, 0xfffffffd,
+  0xfcfcffff, 0xfffffffc, 0xf8f8ffff, 0xfffffff8, 0xf1f1ffff, 0xfffffff1, 0xe3e3ffff, 0xffffffe1,
+  0xc7c7ffff, 0xffffffc5, 0x8f8fffff, 0xffffff8d, 0x1f1fffff, 0xffffff1d, 0x3f3fffff, 0xffffff3d,
+  0x0c000000, 0x000f0c0c, 0x00000000, 0x00000000, 0x01000000, 0x00070101, 0x03070000, 0x0f0f0301,
+  0x07070000, 0x1f1f0705, 0x8fffffff, 0xffff8f8d, 0x1fffffff, 0xffff1f1d, 0x3fffffff, 0xffff3f3d,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03000000, 0x07030301,
+  0x0f070000, 0x0f070705, 0xffffffff, 0xff8f8f8d, 0xffffffff, 0xff1f1f1d, 0xffffffff, 0xff3f3f3d,
+  0x00000000, 0x0c0c0c0c, 0x00000000, 0x00000000, 0x00000000, 0x01010101, 0x03000000, 0x0303030d,
+  0x1f070000, 0x0707071d, 0xffffffff, 0x8f8f8ffd, 0xffffffff, 0x1f1f1ffd, 0xffffffff, 0x3f3f3ffd,
+  0x00000000, 0x0c0c0f0d, 0x00000000, 0x00080f0d, 0x00000000, 0x01010f0d, 0x03000000, 0x03031f1d,
+  0x1f070000, 0x07073f3d, 0xffffffff, 0x8f8ffffd, 0xffffffff, 0x1f1ffffd, 0xffffffff, 0x3f3ffffd,
+  0xfffffcfc, 0xfffffffd, 0xfffff8f8, 0xfffffffd, 0xfffff1f1, 0xfffffffd, 0xffffe3e3, 0xfffffffd,
+  0xffffc7c7, 0xfffffffd, 0xffff8f8f, 0xfffffffd, 0xffff1f1f, 0xfffffffd, 0xffff3f3f, 0xfffffffd,
+  0xfffcfcfc, 0xfffffffd, 0xfff8f8f8, 0xfffffffd, 0xfff1f1f1, 0xfffffffd, 0xffe3e3e3, 0xfffffffd,
+  0xffc7c7c7, 0xfffffffd, 0xff8f8f8f, 0xfffffffd, 0xff1f1f1f, 0xfffffffd, 0xff3f3f3f, 0xfffffffd,
+  0xfcfcfcff, 0xfffffffd, 0xf8f8f8ff, 0xfffffffd, 0xf1f1f1ff, 0xfffffffd, 0xe3e3e3ff, 0xfffffffd,
+  0xc7c7c7ff, 0xfffffffd, 0x8f8f8fff, 0xfffffffd, 0x1f1f1fff, 0xfffffffd, 0x3f3f3fff, 0xfffffffd,
+  0x04000000, 0x00000704, 0x00000000, 0x00000700, 0x01000000, 0x00000701, 0x03000000, 0x00070f01,
+  0x07070000, 0x0f0f1f05, 0x0f070000, 0x1f1f3f0d, 0x1f1fffff, 0xffffff1d, 0x3f3fffff, 0xffffff3d,
+  0x00000000, 0x00000404, 0x00000000, 0x00000000, 0x00000000, 0x00000101, 0x03000000, 0x00070301,
+  0x03000000, 0x070f0705, 0x0f070000, 0x0f1f0f0d, 0x1fffffff, 0xffff1f1d, 0x3fffffff, 0xffff3f3d,
+  0x00000000, 0x00000400, 0x00000000, 0x00000000, 0x00000000, 0x00000100, 0x00000000, 0x00030301,
+  0x03000000, 0x07070705, 0x0f070000, 0x0f0f0f0d, 0xffffffff, 0xff1f1f1d, 0xffffffff, 0xff3f3f3d,
+  0x00000000, 0x00040400, 0x00000000, 0x00000000, 0x00000000, 0x00010100, 0x00000000, 0x03030301,
+  0x03000000, 0x0707070d, 0x0f070000, 0x0f0f0f1d, 0xffffffff, 0x1f1f1ffd, 0xffffffff, 0x3f3f3ffd,
+  0x00000000, 0x04040700, 0x00000000, 0x00000700, 0x00000000, 0x01010700, 0x00000000, 0x03030f01,
+  0x03000000, 0x07071f0d, 0x1f070000, 0x0f0f3f1d, 0xffffffff, 0x1f1ffffd, 0xffffffff, 0x3f3ffffd,
+  0xfffffcfc, 0xfffffffb, 0xfffff8f8, 0xfffffffb, 0xfffff1f1, 0xfffffffb, 0xffffe3e3, 0xfffffffb,
+  0xffffc7c7, 0xfffffffb, 0xffff8f8f, 0xfffffffb, 0xffff1f1f, 0xfffffffb, 0xffff3f3f, 0xfffffffb,
+  0xfffcfcfc, 0xfffffffb, 0xfff8f8f8, 0xfffffffb, 0xfff1f1f1, 0xfffffffb, 0xffe3e3e3, 0xfffffffb,
+  0xffc7c7c7, 0xfffffffb, 0xff8f8f8f, 0xfffffffb, 0xff1f1f1f, 0xfffffffb, 0xff3f3f3f, 0xfffffffb,
+  0xfcfcfcff, 0xfffffffb, 0xf8f8f8ff, 0xfffffffb, 0xf1f1f1ff, 0xfffffffb, 0xe3e3e3ff, 0xfffffffb,
+  0xc7c7c7ff, 0xfffffffb, 0x8f8f8fff, 0xfffffffb, 0x1f1f1fff, 0xfffffffb, 0x3f3f3fff, 0xfffffffb,
+  0xfcfcffff, 0xfffffff8, 0xf8f8ffff, 0xfffffff8, 0xf1f1ffff, 0xfffffff1, 0xe3e3ffff, 0xffffffe3,
+  0xc7c7ffff, 0xffffffc3, 0x8f8fffff, 0xffffff8b, 0x1f1fffff, 0xffffff1b, 0x3f3fffff, 0xffffff3b,
+  0x3c3e0000, 0x3f3f3c38, 0x18000000, 0x001e1818, 0x00000000, 0x00000000, 0x03000000, 0x000f0303,
+  0x070f0000, 0x1f1f0703, 0x0f0f0000, 0x3f3f0f0b, 0x1fffffff, 0xffff1f1b, 0x3fffffff, 0xffff3f3b,
+  0x3c000000, 0x3e3c3c38, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x07000000, 0x0f070703, 0x1f0f0000, 0x1f0f0f0b, 0xffffffff, 0xff1f1f1b, 0xffffffff, 0xff3f3f3b,
+  0x3c000000, 0x3c3c3c3b, 0x00000000, 0x18181818, 0x00000000, 0x00000000, 0x00000000, 0x03030303,
+  0x07000000, 0x0707071b, 0x3f0f0000, 0x0f0f0f3b, 0xffffffff, 0x1f1f1ffb, 0xffffffff, 0x3f3f3ffb,
+  0x3c000000, 0x3c3c3f3b, 0x00000000, 0x18181f1b, 0x00000000, 0x00111f1b, 0x00000000, 0x03031f1b,
+  0x07000000, 0x07073f3b, 0x3f0f0000, 0x0f0f7f7b, 0xffffffff, 0x1f1ffffb, 0xffffffff, 0x3f3ffffb,
+  0xfffffcfc, 0xfffffffb, 0xfffff8f8, 0xfffffffb, 0xfffff1f1, 0xfffffffb, 0xffffe3e3, 0xfffffffb,
+  0xffffc7c7, 0xfffffffb, 0xffff8f8f, 0xfffffffb, 0xffff1f1f, 0xfffffffb, 0xffff3f3f, 0xfffffffb,
+  0xfffcfcfc, 0xfffffffb, 0xfff8f8f8, 0xfffffffb, 0xfff1f1f1, 0xfffffffb, 0xffe3e3e3, 0xfffffffb,
+  0xffc7c7c7, 0xfffffffb, 0xff8f8f8f, 0xfffffffb, 0xff1f1f1f, 0xfffffffb, 0xff3f3f3f, 0xfffffffb,
+  0xfcfcfcff, 0xfffffffb, 0xf8f8f8ff, 0xfffffffb, 0xf1f1f1ff, 0xfffffffb, 0xe3e3e3ff, 0xfffffffb,
+  0xc7c7c7ff, 0xfffffffb, 0x8f8f8fff, 0xfffffffb, 0x1f1f1fff, 0xfffffffb, 0x3f3f3fff, 0xfffffffb,
+  0x1c000000, 0x001e1f18, 0x08000000, 0x00000e08, 0x00000000, 0x00000e00, 0x02000000, 0x00000e02,
+  0x07000000, 0x000f1f03, 0x0f0f0000, 0x1f1f3f0b, 0x1f0f0000, 0x3f3f7f1b, 0x3f3fffff, 0xffffff3b,
+  0x1c000000, 0x001e1c18, 0x00000000, 0x00000808, 0x00000000, 0x00000000, 0x00000000, 0x00000202,
+  0x07000000, 0x000f0703, 0x07000000, 0x0f1f0f0b, 0x1f0f0000, 0x1f3f1f1b, 0x3fffffff, 0xffff3f3b,
+  0x00000000, 0x001c1c18, 0x00000000, 0x00000800, 0x00000000, 0x00000000, 0x00000000, 0x00000200,
+  0x00000000, 0x00070703, 0x07000000, 0x0f0f0f0b, 0x1f0f0000, 0x1f1f1f1b, 0xffffffff, 0xff3f3f3b,
+  0x00000000, 0x1c1c1c18, 0x00000000, 0x00080800, 0x00000000, 0x00000000, 0x00000000, 0x00020200,
+  0x00000000, 0x07070703, 0x07000000, 0x0f0f0f1b, 0x1f0f0000, 0x1f1f1f3b, 0xffffffff, 0x3f3f3ffb,
+  0x00000000, 0x1c1c1f18, 0x00000000, 0x08080e00, 0x00000000, 0x00000e00, 0x00000000, 0x02020e00,
+  0x00000000, 0x07071f03, 0x07000000, 0x0f0f3f1b, 0x3f0f0000, 0x1f1f7f3b, 0xffffffff, 0x3f3ffffb,
+  0xfffffcfc, 0xfffffff7, 0xfffff8f8, 0xfffffff7, 0xfffff1f1, 0xfffffff7, 0xffffe3e3, 0xfffffff7,
+  0xffffc7c7, 0xfffffff7, 0xffff8f8f, 0xfffffff7, 0xffff1f1f, 0xfffffff7, 0xffff3f3f, 0xfffffff7,
+  0xfffcfcfc, 0xfffffff7, 0xfff8f8f8, 0xfffffff7, 0xfff1f1f1, 0xfffffff7, 0xffe3e3e3, 0xfffffff7,
+  0xffc7c7c7, 0xfffffff7, 0xff8f8f8f, 0xfffffff7, 0xff1f1f1f, 0xfffffff7, 0xff3f3f3f, 0xfffffff7,
+  0xfcfcfcff, 0xfffffff7, 0xf8f8f8ff, 0xfffffff7, 0xf1f1f1ff, 0xfffffff7, 0xe3e3e3ff, 0xfffffff7,
+  0xc7c7c7ff, 0xfffffff7, 0x8f8f8fff, 0xfffffff7, 0x1f1f1fff, 0xfffffff7, 0x3f3f3fff, 0xfffffff7,
+  0xfcfcffff, 0xfffffff4, 0xf8f8ffff, 0xfffffff0, 0xf1f1ffff, 0xfffffff1, 0xe3e3ffff, 0xffffffe3,
+  0xc7c7ffff, 0xffffffc7, 0x8f8fffff, 0xffffff87, 0x1f1fffff, 0xffffff17, 0x3f3fffff, 0xffffff37,
+  0xfcfc0000, 0xfffffcf4, 0x787c0000, 0x7e7e7870, 0x30000000, 0x003c3030, 0x00000000, 0x00000000,
+  0x06000000, 0x001e0606, 0x0f1f0000, 0x3f3f0f07, 0x1f1f0000, 0x7f7f1f17, 0x3fffffff, 0xffff3f37,
+  0xfefc0000, 0xfefcfcf4, 0x78000000, 0x7c787870, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0f000000, 0x1f0f0f07, 0x3f1f0000, 0x3f1f1f17, 0xffffffff, 0xff3f3f37,
+  0xfffc0000, 0xfcfcfcf7, 0x78000000, 0x78787876, 0x00000000, 0x30303030, 0x00000000, 0x00000000,
+  0x00000000, 0x06060606, 0x0f000000, 0x0f0f0f37, 0x7f1f0000, 0x1f1f1f77, 0xffffffff, 0x3f3f3ff7,
+  0xfffc0000, 0xfcfcfff7, 0x78000000, 0x78787f77, 0x00000000, 0x30303e36, 0x00000000, 0x00223e36,
+  0x00000000, 0x06063e36, 0x0f000000, 0x0f0f7f77, 0x7f1f0000, 0x1f1ffff7, 0xffffffff, 0x3f3ffff7,
+  0xfffffcfc, 0xfffffff7, 0xfffff8f8, 0xfffffff7, 0xfffff1f1, 0xfffffff7, 0xffffe3e3, 0xfffffff7,
+  0xffffc7c7, 0xfffffff7, 0xffff8f8f, 0xfffffff7, 0xffff1f1f, 0xfffffff7, 0xffff3f3f, 0xfffffff7,
+  0xfffcfcfc, 0xfffffff7, 0xfff8f8f8, 0xfffffff7, 0xfff1f1f1, 0xfffffff7, 0xffe3e3e3, 0xfffffff7,
+  0xffc7c7c7, 0xfffffff7, 0xff8f8f8f, 0xfffffff7, 0xff1f1f1f, 0xfffffff7, 0xff3f3f3f, 0xfffffff7,
+  0xfcfcfcff, 0xfffffff7, 0xf8f8f8ff, 0xfffffff7, 0xf1f1f1ff, 0xfffffff7, 0xe3e3e3ff, 0xfffffff7,
+  0xc7c7c7ff, 0xfffffff7, 0x8f8f8fff, 0xfffffff7, 0x1f1f1fff, 0xfffffff7, 0x3f3f3fff, 0xfffffff7,
+  0x7c7c0000, 0x7e7e7f74, 0x38000000, 0x003c3e30, 0x10000000, 0x00001c10, 0x00000000, 0x00001c00,
+  0x04000000, 0x00001c04, 0x0e000000, 0x001e3e06, 0x1f1f0000, 0x3f3f7f17, 0x3f1f0000, 0x7f7fff37,
+  0x78000000, 0x7c7e7c74, 0x38000000, 0x003c3830, 0x00000000, 0x00001010, 0x00000000, 0x00000000,
+  0x00000000, 0x00000404, 0x0e000000, 0x001e0e06, 0x0f000000, 0x1f3f1f17, 0x3f1f0000, 0x3f7f3f37,
+  0x78000000, 0x7c7c7c74, 0x00000000, 0x00383830, 0x00000000, 0x00001000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000400, 0x00000000, 0x000e0e06, 0x0f000000, 0x1f1f1f17, 0x3f1f0000, 0x3f3f3f37,
+  0x78000000, 0x7c7c7c76, 0x00000000, 0x38383830, 0x00000000, 0x00101000, 0x00000000, 0x00000000,
+  0x00000000, 0x00040400, 0x00000000, 0x0e0e0e06, 0x0f000000, 0x1f1f1f37, 0x3f1f0000, 0x3f3f3f77,
+  0x78000000, 0x7c7c7f76, 0x00000000, 0x38383e30, 0x00000000, 0x10101c00, 0x00000000, 0x00001c00,
+  0x00000000, 0x04041c00, 0x00000000, 0x0e0e3e06, 0x0f000000, 0x1f1f7f37, 0x7f1f0000, 0x3f3fff77,
+  0xfefffcfc, 0xffffffff, 0xfefff8f8, 0xffffffff, 0xfefff1f1, 0xffffffff, 0xfeffe3e3, 0xffffffff,
+  0xfeffc7c7, 0xffffffff, 0xfeff8f8f, 0xffffffff, 0xfeff1f1f, 0xffffffff, 0xfeff3f3f, 0xffffffff,
+  0xfefcfcfc, 0xffffffff, 0xfef8f8f8, 0xffffffff, 0xfef1f1f1, 0xffffffff, 0xfee3e3e3, 0xffffffff,
+  0xfec7c7c7, 0xffffffff, 0xfe8f8f8f, 0xffffffff, 0xfe1f1f1f, 0xffffffff, 0xfe3f3f3f, 0xffffffff,
+  0xfcfcfcff, 0xffffffff, 0xf8f8f8ff, 0xffffffff, 0xf0f1f1ff, 0xffffffff, 0xe2e3e3ff, 0xffffffff,
+  0xc6c7c7ff, 0xffffffff, 0x8e8f8fff, 0xffffffff, 0x1e1f1fff, 0xffffffff, 0x3e3f3fff, 0xffffffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000300, 0x00000000, 0x00070701, 0x02030000, 0x070f0f03,
+  0x06070000, 0x0f1f1f07, 0x8e8fffff, 0xffffff8f, 0x1e1fffff, 0xffffff1f, 0x3e3fffff, 0xffffff3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x02000000, 0x07070303,
+  0x06000000, 0x0f0f0707, 0x8effffff, 0xffff8f8f, 0x1effffff, 0xffff1f1f, 0x3effffff, 0xffff3f3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x07030303,
+  0x00000000, 0x0f070707, 0xfeffffff, 0xff8f8f8f, 0xfeffffff, 0xff1f1f1f, 0xfeffffff, 0xff3f3f3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03030300,
+  0x00000000, 0x0707070f, 0xfeffffff, 0x8f8f8fff, 0xfeffffff, 0x1f1f1fff, 0xfeffffff, 0x3f3f3fff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03030700,
+  0x00000000, 0x07070f0f, 0xfeffffff, 0x8f8fffff, 0xfeffffff, 0x1f1fffff, 0xfeffffff, 0x3f3fffff,
+  0xfefffcfc, 0xffffffff, 0xfefff8f8, 0xffffffff, 0xfefff1f1, 0xffffffff, 0xfeffe3e3, 0xffffffff,
+  0xfeffc7c7, 0xffffffff, 0xfeff8f8f, 0xffffffff, 0xfeff1f1f, 0xffffffff, 0xfeff3f3f, 0xffffffff,
+  0xfefcfcfc, 0xffffffff, 0xfef8f8f8, 0xffffffff, 0xfef1f1f1, 0xffffffff, 0xfee3e3e3, 0xffffffff,
+  0xfec7c7c7, 0xffffffff, 0xfe8f8f8f, 0xffffffff, 0xfe1f1f1f, 0xffffffff, 0xfe3f3f3f, 0xffffffff,
+  0x00000000, 0x00000003, 0x00000000, 0x00000003, 0x00000000, 0x00000307, 0x02020000, 0x0007070f,
+  0x06070000, 0x070f0f1f, 0x0e0f0000, 0x0f1f1f3f, 0x1e1f1fff, 0xffffffff, 0x3e3f3fff, 0xffffffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x02000000, 0x00020602,
+  0x06000000, 0x07070f07, 0x0e000000, 0x0f0f1f0f, 0x1e1fffff, 0xffffff1f, 0x3e3fffff, 0xffffff3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020202,
+  0x00000000, 0x07070707, 0x00000000, 0x0f0f0f0f, 0x1effffff, 0xffff1f1f, 0x3effffff, 0xffff3f3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020200,
+  0x00000000, 0x07070700, 0x00000000, 0x0f0f0f0f, 0xfeffffff, 0xff1f1f1f, 0xfeffffff, 0xff3f3f3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000,
+  0x00000000, 0x07070700, 0x00000000, 0x0f0f0f0f, 0xfeffffff, 0x1f1f1fff, 0xfeffffff, 0x3f3f3fff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02020000,
+  0x00000000, 0x07070700, 0x00000000, 0x0f0f0f0f, 0xfeffffff, 0x1f1fffff, 0xfeffffff, 0x3f3fffff,
+  0xfdfffcfc, 0xffffffff, 0xfdfff8f8, 0xffffffff, 0xfdfff1f1, 0xffffffff, 0xfdffe3e3, 0xffffffff,
+  0xfdffc7c7, 0xffffffff, 0xfdff8f8f, 0xffffffff, 0xfdff1f1f, 0xffffffff, 0xfdff3f3f, 0xffffffff,
+  0xfdfcfcfc, 0xffffffff, 0xfdf8f8f8, 0xffffffff, 0xfdf1f1f1, 0xffffffff, 0xfde3e3e3, 0xffffffff,
+  0xfdc7c7c7, 0xffffffff, 0xfd8f8f8f, 0xffffffff, 0xfd1f1f1f, 0xffffffff, 0xfd3f3f3f, 0xffffffff,
+  0xfcfcfcff, 0xffffffff, 0xf8f8f8ff, 0xffffffff, 0xf1f1f1ff, 0xffffffff, 0xe1e3e3ff, 0xffffffff,
+  0xc5c7c7ff, 0xffffffff, 0x8d8f8fff, 0xffffffff, 0x1d1f1fff, 0xffffffff, 0x3d3f3fff, 0xffffffff,
+  0x0c0c0000, 0x00000f0c, 0x00000000, 0x00000000, 0x01010000, 0x00000701, 0x01030700, 0x000f0f03,
+  0x05070700, 0x0f1f1f07, 0x0d0f1f0f, 0x1f3f3f0f, 0x1d1fffff, 0xffffff1f, 0x3d3fffff, 0xffffff3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01030000, 0x00070303,
+  0x050f0700, 0x0f0f0707, 0x0d1f1f0f, 0x1f1f0f0f, 0x1dffffff, 0xffff1f1f, 0x3dffffff, 0xffff3f3f,
+  0x0c000000, 0x000c0c0c, 0x00000000, 0x00000000, 0x01000000, 0x00010101, 0x05030000, 0x07030303,
+  0x0d0f0700, 0x0f070707, 0x1d1f1f0f, 0x1f0f0f0f, 0xfdffffff, 0xff1f1f1f, 0xfdffffff, 0xff3f3f3f,
+  0x0d000000, 0x0c0c0c0e, 0x05000000, 0x00000005, 0x0d000000, 0x0101010b, 0x1d030000, 0x03030317,
+  0x3d0f0700, 0x0707072f, 0x7d1f1f0f, 0x0f0f0f5f, 0xfdffffff, 0x1f1f1fff, 0xfdffffff, 0x3f3f3fff,
+  0x0c000000, 0x0c0c0f0f, 0x00000000, 0x00080f0f, 0x01000000, 0x01010f0f, 0x05030000, 0x03031f1f,
+  0x0d0f0700, 0x07073f3f, 0x1d1f1f0f, 0x0f0f7f7f, 0xfdffffff, 0x1f1fffff, 0xfdffffff, 0x3f3fffff,
+  0xfdfffcfc, 0xffffffff, 0xfdfff8f8, 0xffffffff, 0xfdfff1f1, 0xffffffff, 0xfdffe3e3, 0xffffffff,
+  0xfdffc7c7, 0xffffffff, 0xfdff8f8f, 0xffffffff, 0xfdff1f1f, 0xffffffff, 0xfdff3f3f, 0xffffffff,
+  0xfdfcfcfc, 0xffffffff, 0xfdf8f8f8, 0xffffffff, 0xfdf1f1f1, 0xffffffff, 0xfde3e3e3, 0xffffffff,
+  0xfdc7c7c7, 0xffffffff, 0xfd8f8f8f, 0xffffffff, 0xfd1f1f1f, 0xffffffff, 0xfd3f3f3f, 0xffffffff,
+  0x04040000, 0x00000007, 0x00000000, 0x00000007, 0x01010000, 0x00000007, 0x01030000, 0x0000070f,
+  0x05070700, 0x000f0f1f, 0x0d0f0700, 0x0f1f1f3f, 0x1d1f1f0f, 0x1f3f3f7f, 0x3d3f3fff, 0xffffffff,
+  0x04000000, 0x00000004, 0x00000000, 0x00000000, 0x01000000, 0x00000001, 0x01030000, 0x00000703,
+  0x05030000, 0x00070f07, 0x0d0f0700, 0x0f0f1f0f, 0x1d1f1f0f, 0x1f1f3f1f, 0x3d3fffff, 0xffffff3f,
+  0x00000000, 0x00000004, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x01000000, 0x00000303,
+  0x05030000, 0x00070707, 0x0d0f0700, 0x0f0f0f0f, 0x1d1f1f0f, 0x1f1f1f1f, 0x3dffffff, 0xffff3f3f,
+  0x00000000, 0x00000404, 0x00000000, 0x00000000, 0x00000000, 0x00000101, 0x01000000, 0x00030303,
+  0x05030000, 0x00070707, 0x0d0f0700, 0x0f0f0f0f, 0x1d1f1f0f, 0x1f1f1f1f, 0xfdffffff, 0xff3f3f3f,
+  0x00000000, 0x00040405, 0x00000000, 0x00000002, 0x00000000, 0x00010105, 0x01000000, 0x0003030b,
+  0x05030000, 0x07070717, 0x0d0f0700, 0x0f0f0f2f, 0x1d1f1f0f, 0x1f1f1f5f, 0xfdffffff, 0x3f3f3fff,
+  0x00000000, 0x04040704, 0x00000000, 0x00000700, 0x00000000, 0x01010701, 0x01000000, 0x03030f03,
+  0x05030000, 0x07071f07, 0x0d0f0700, 0x0f0f3f0f, 0x1d1f1f0f, 0x1f1f7f5f, 0xfdffffff, 0x3f3fffff,
+  0xfbfffcfc, 0xffffffff, 0xfbfff8f8, 0xffffffff, 0xfbfff1f1, 0xffffffff, 0xfbffe3e3, 0xffffffff,
+  0xfbffc7c7, 0xffffffff, 0xfbff8f8f, 0xffffffff, 0xfbff1f1f, 0xffffffff, 0xfbff3f3f, 0xffffffff,
+  0xfbfcfcfc, 0xffffffff, 0xfbf8f8f8, 0xffffffff, 0xfbf1f1f1, 0xffffffff, 0xfbe3e3e3, 0xffffffff,
+  0xfbc7c7c7, 0xffffffff, 0xfb8f8f8f, 0xffffffff, 0xfb1f1f1f, 0xffffffff, 0xfb3f3f3f, 0xffffffff,
+  0xf8fcfcff, 0xffffffff, 0xf8f8f8ff, 0xffffffff, 0xf1f1f1ff, 0xffffffff, 0xe3e3e3ff, 0xffffffff,
+  0xc3c7c7ff, 0xffffffff, 0x8b8f8fff, 0xffffffff, 0x1b1f1fff, 0xffffffff, 0x3b3f3fff, 0xffffffff,
+  0x383c3e00, 0x003f3f3c, 0x18180000, 0x00001e18, 0x00000000, 0x00000000, 0x03030000, 0x00000f03,
+  0x03070f00, 0x001f1f07, 0x0b0f0f00, 0x1f3f3f0f, 0x1b1f3f1f, 0x3f7f7f1f, 0x3b3fffff, 0xffffff3f,
+  0x383c0000, 0x003e3c3c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x03070000, 0x000f0707, 0x0b1f0f00, 0x1f1f0f0f, 0x1b3f3f1f, 0x3f3f1f1f, 0x3bffffff, 0xffff3f3f,
+  0x3a3c0000, 0x3e3c3c3c, 0x18000000, 0x00181818, 0x00000000, 0x00000000, 0x03000000, 0x00030303,
+  0x0b070000, 0x0f070707, 0x1b1f0f00, 0x1f0f0f0f, 0x3b3f3f1f, 0x3f1f1f1f, 0xfbffffff, 0xff3f3f3f,
+  0x3b3c0000, 0x3c3c3c3e, 0x1b000000, 0x1818181d, 0x0a000000, 0x0000000a, 0x1b000000, 0x03030317,
+  0x3b070000, 0x0707072f, 0x7b1f0f00, 0x0f0f0f5f, 0xfb3f3f1f, 0x1f1f1fbf, 0xfbffffff, 0x3f3f3fff,
+  0x3a3c0000, 0x3c3c3f3f, 0x18000000, 0x18181f1f, 0x00000000, 0x00111f1f, 0x03000000, 0x03031f1f,
+  0x0b070000, 0x07073f3f, 0x1b1f0f00, 0x0f0f7f7f, 0x3b3f3f1f, 0x1f1fffff, 0xfbffffff, 0x3f3fffff,
+  0xfbfffcfc, 0xffffffff, 0xfbfff8f8, 0xffffffff, 0xfbfff1f1, 0xffffffff, 0xfbffe3e3, 0xffffffff,
+  0xfbffc7c7, 0xffffffff, 0xfbff8f8f, 0xffffffff, 0xfbff1f1f, 0xffffffff, 0xfbff3f3f, 0xffffffff,
+  0xfbfcfcfc, 0xffffffff, 0xfbf8f8f8, 0xffffffff, 0xfbf1f1f1, 0xffffffff, 0xfbe3e3e3, 0xffffffff,
+  0xfbc7c7c7, 0xffffffff, 0xfb8f8f8f, 0xffffffff, 0xfb1f1f1f, 0xffffffff, 0xfb3f3f3f, 0xffffffff,
+  0x181c0000, 0x00001e1f, 0x08080000, 0x0000000e, 0x00000000, 0x0000000e, 0x02020000, 0x0000000e,
+  0x03070000, 0x00000f1f, 0x0b0f0f00, 0x001f1f3f, 0x1b1f0f00, 0x1f3f3f7f, 0x3b3f3f1f, 0x3f7f7fff,
+  0x181c0000, 0x00001e1c, 0x08000000, 0x00000008, 0x00000000, 0x00000000, 0x02000000, 0x00000002,
+  0x03070000, 0x00000f07, 0x0b070000, 0x000f1f0f, 0x1b1f0f00, 0x1f1f3f1f, 0x3b3f3f1f, 0x3f3f7f3f,
+  0x18000000, 0x00001c1c, 0x00000000, 0x00000008, 0x00000000, 0x00000000, 0x00000000, 0x00000002,
+  0x03000000, 0x00000707, 0x0b070000, 0x000f0f0f, 0x1b1f0f00, 0x1f1f1f1f, 0x3b3f3f1f, 0x3f3f3f3f,
+  0x18000000, 0x001c1c1c, 0x00000000, 0x00000808, 0x00000000, 0x00000000, 0x00000000, 0x00000202,
+  0x03000000, 0x00070707, 0x0b070000, 0x000f0f0f, 0x1b1f0f00, 0x1f1f1f1f, 0x3b3f3f1f, 0x3f3f3f3f,
+  0x18000000, 0x001c1c1d, 0x00000000, 0x0008080a, 0x00000000, 0x00000004, 0x00000000, 0x0002020a,
+  0x03000000, 0x00070717, 0x0b070000, 0x0f0f0f2f, 0x1b1f0f00, 0x1f1f1f5f, 0x3b3f3f1f, 0x3f3f3fbf,
+  0x18000000, 0x1c1c1f1c, 0x00000000, 0x08080e08, 0x00000000, 0x00000e00, 0x00000000, 0x02020e02,
+  0x03000000, 0x07071f07, 0x0b070000, 0x0f0f3f0f, 0x1b1f0f00, 0x1f1f7f1f, 0x3b3f3f1f, 0x3f3fffbf,
+  0xf7fffcfc, 0xffffffff, 0xf7fff8f8, 0xffffffff, 0xf7fff1f1, 0xffffffff, 0xf7ffe3e3, 0xffffffff,
+  0xf7ffc7c7, 0xffffffff, 0xf7ff8f8f, 0xffffffff, 0xf7ff1f1f, 0xffffffff, 0xf7ff3f3f, 0xffffffff,
+  0xf7fcfcfc, 0xffffffff, 0xf7f8f8f8, 0xffffffff, 0xf7f1f1f1, 0xffffffff, 0xf7e3e3e3, 0xffffffff,
+  0xf7c7c7c7, 0xffffffff, 0xf78f8f8f, 0xffffffff, 0xf71f1f1f, 0xffffffff, 0xf73f3f3f, 0xffffffff,
+  0xf4fcfcff, 0xffffffff, 0xf0f8f8ff, 0xffffffff, 0xf1f1f1ff, 0xffffffff, 0xe3e3e3ff, 0xffffffff,
+  0xc7c7c7ff, 0xffffffff, 0x878f8fff, 0xffffffff, 0x171f1fff, 0xffffffff, 0x373f3fff, 0xffffffff,
+  0xf4fcfc00, 0xfefffffc, 0x70787c00, 0x007e7e78, 0x30300000, 0x00003c30, 0x00000000, 0x00000000,
+  0x06060000, 0x00001e06, 0x070f1f00, 0x003f3f0f, 0x171f1f00, 0x3f7f7f1f, 0x373f7f3f, 0x7fffff3f,
+  0xf4fefc00, 0xfefefcfc, 0x70780000, 0x007c7878, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x070f0000, 0x001f0f0f, 0x173f1f00, 0x3f3f1f1f, 0x377f7f3f, 0x7f7f3f3f,
+  0xf6fefc00, 0xfefcfcfc, 0x74780000, 0x7c787878, 0x30000000, 0x00303030, 0x00000000, 0x00000000,
+  0x06000000, 0x00060606, 0x170f0000, 0x1f0f0f0f, 0x373f1f00, 0x3f1f1f1f, 0x777f7f3f, 0x7f3f3f3f,
+  0xf7fefc00, 0xfcfcfcfe, 0x77780000, 0x7878787d, 0x36000000, 0x3030303a, 0x14000000, 0x00000014,
+  0x36000000, 0x0606062e, 0x770f0000, 0x0f0f0f5f, 0xf73f1f00, 0x1f1f1fbf, 0xf77f7f3f, 0x3f3f3f7f,
+  0xf6fefc00, 0xfcfcffff, 0x74780000, 0x78787f7f, 0x30000000, 0x30303e3e, 0x00000000, 0x00223e3e,
+  0x06000000, 0x06063e3e, 0x170f0000, 0x0f0f7f7f, 0x373f1f00, 0x1f1fffff, 0x777f7f3f, 0x3f3fffff,
+  0xf7fffcfc, 0xffffffff, 0xf7fff8f8, 0xffffffff, 0xf7fff1f1, 0xffffffff, 0xf7ffe3e3, 0xffffffff,
+  0xf7ffc7c7, 0xffffffff, 0xf7ff8f8f, 0xffffffff, 0xf7ff1f1f, 0xffffffff, 0xf7ff3f3f, 0xffffffff,
+  0xf7fcfcfc, 0xffffffff, 0xf7f8f8f8, 0xffffffff, 0xf7f1f1f1, 0xffffffff, 0xf7e3e3e3, 0xffffffff,
+  0xf7c7c7c7, 0xffffffff, 0xf78f8f8f, 0xffffffff, 0xf71f1f1f, 0xffffffff, 0xf73f3f3f, 0xffffffff,
+  0x747c7c00, 0x007e7e7f, 0x30380000, 0x00003c3e, 0x10100000, 0x0000001c, 0x00000000, 0x0000001c,
+  0x04040000, 0x0000001c, 0x060e0000, 0x00001e3e, 0x171f1f00, 0x003f3f7f, 0x373f1f00, 0x3f7f7fff,
+  0x74780000, 0x007c7e7c, 0x30380000, 0x00003c38, 0x10000000, 0x00000010, 0x00000000, 0x00000000,
+  0x04000000, 0x00000004, 0x060e0000, 0x00001e0e, 0x170f0000, 0x001f3f1f, 0x373f1f00, 0x3f3f7f3f,
+  0x74780000, 0x007c7c7c, 0x30000000, 0x00003838, 0x00000000, 0x00000010, 0x00000000, 0x00000000,
+  0x00000000, 0x00000004, 0x06000000, 0x00000e0e, 0x170f0000, 0x001f1f1f, 0x373f1f00, 0x3f3f3f3f,
+  0x74780000, 0x007c7c7c, 0x30000000, 0x00383838, 0x00000000, 0x00001010, 0x00000000, 0x00000000,
+  0x00000000, 0x00000404, 0x06000000, 0x000e0e0e, 0x170f0000, 0x001f1f1f, 0x373f1f00, 0x3f3f3f3f,
+  0x74780000, 0x7c7c7c7d, 0x30000000, 0x0038383a, 0x00000000, 0x00101014, 0x00000000, 0x00000008,
+  0x00000000, 0x00040414, 0x06000000, 0x000e0e2e, 0x170f0000, 0x1f1f1f5f, 0x373f1f00, 0x3f3f3fbf,
+  0x74780000, 0x7c7c7f7c, 0x30000000, 0x38383e38, 0x00000000, 0x10101c10, 0x00000000, 0x00001c00,
+  0x00000000, 0x04041c04, 0x06000000, 0x0e0e3e0e, 0x170f0000, 0x1f1f7f1f, 0x373f1f00, 0x3f3fff3f,
+  0xfffefcfc, 0xffffffff, 0xfffef8f8, 0xffffffff, 0xfffef1f1, 0xffffffff, 0xfffee3e3, 0xffffffff,
+  0xfffec7c7, 0xffffffff, 0xfffe8f8f, 0xffffffff, 0xfffe1f1f, 0xffffffff, 0xfffe3f3f, 0xffffffff,
+  0xfffcfcfc, 0xffffffff, 0xfff8f8f8, 0xffffffff, 0xfff0f1f1, 0xffffffff, 0xffe2e3e3, 0xffffffff,
+  0xffc6c7c7, 0xffffffff, 0xff8e8f8f, 0xffffffff, 0xff1e1f1f, 0xffffffff, 0xff3e3f3f, 0xffffffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000003, 0x01000000, 0x00000707, 0x03020300, 0x00070f0f,
+  0x07060700, 0x0f0f1f1f, 0x0f0e0f00, 0x1f1f3f3f, 0x1f1e1fff, 0xffffffff, 0x3f3e3fff, 0xffffffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x03020000, 0x00070703,
+  0x07060000, 0x0f0f0f07, 0x0f0e0000, 0x1f1f1f0f, 0x1f1effff, 0xffffff1f, 0x3f3effff, 0xffffff3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03000000, 0x00070303,
+  0x07000000, 0x0f0f0707, 0x0f000000, 0x1f1f0f0f, 0x1ffeffff, 0xffff1f1f, 0x3ffeffff, 0xffff3f3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00030303,
+  0x00000000, 0x0f070707, 0x1f000000, 0x1f0f0f0f, 0xfffeffff, 0xff1f1f1f, 0xfffeffff, 0xff3f3f3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03030300,
+  0x00000000, 0x0707070f, 0x1f000000, 0x0f0f0f1f, 0xfffeffff, 0x1f1f1fff, 0xfffeffff, 0x3f3f3fff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03030700,
+  0x00000000, 0x07070f0f, 0x1f000000, 0x0f0f1f1f, 0xfffeffff, 0x1f1fffff, 0xfffeffff, 0x3f3fffff,
+  0xfffefcfc, 0xffffffff, 0xfffef8f8, 0xffffffff, 0xfffef1f1, 0xffffffff, 0xfffee3e3, 0xffffffff,
+  0xfffec7c7, 0xffffffff, 0xfffe8f8f, 0xffffffff, 0xfffe1f1f, 0xffffffff, 0xfffe3f3f, 0xffffffff,
+  0x03000000, 0x00000000, 0x03000000, 0x00000000, 0x07000000, 0x00000003, 0x0f020200, 0x00000707,
+  0x1f060700, 0x00070f0f, 0x3f0e0f00, 0x0f0f1f1f, 0x7f1e1f00, 0x1f1f3f3f, 0xff3e3f3f, 0xffffffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000002, 0x02020000, 0x00000206,
+  0x07060000, 0x0007070f, 0x0f0e0000, 0x0f0f0f1f, 0x1f1e0000, 0x1f1f1f3f, 0x3f3e3fff, 0xffffffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x00000202,
+  0x07000000, 0x00070707, 0x0f000000, 0x0f0f0f0f, 0x1f000000, 0x1f1f1f1f, 0x3f3effff, 0xffffff3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000202,
+  0x00000000, 0x00070707, 0x00000000, 0x0f0f0f0f, 0x1f000000, 0x1f1f1f1f, 0x3ffeffff, 0xffff3f3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200,
+  0x00000000, 0x00070700, 0x00000000, 0x0f0f0f0f, 0x1f000000, 0x1f1f1f1f, 0xfffeffff, 0xff3f3f3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000,
+  0x00000000, 0x00070700, 0x00000000, 0x0f0f0f0f, 0x1f000000, 0x1f1f1f1f, 0xfffeffff, 0x3f3f3fff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02020000,
+  0x00000000, 0x07070700, 0x00000000, 0x0f0f0f0f, 0x1f000000, 0x1f1f1f1f, 0xfffeffff, 0x3f3fffff,
+  0xfffdfcfc, 0xffffffff, 0xfffdf8f8, 0xffffffff, 0xfffdf1f1, 0xffffffff, 0xfffde3e3, 0xffffffff,
+  0xfffdc7c7, 0xffffffff, 0xfffd8f8f, 0xffffffff, 0xfffd1f1f, 0xffffffff, 0xfffd3f3f, 0xffffffff,
+  0xfffcfcfc, 0xffffffff, 0xfff8f8f8, 0xffffffff, 0xfff1f1f1, 0xffffffff, 0xffe1e3e3, 0xffffffff,
+  0xffc5c7c7, 0xffffffff, 0xff8d8f8f, 0xffffffff, 0xff1d1f1f, 0xffffffff, 0xff3d3f3f, 0xffffffff,
+  0x0c0c0c00, 0x0000000f, 0x00000000, 0x00000000, 0x01010100, 0x00000007, 0x03010307, 0x00000f0f,
+  0x07050707, 0x000f1f1f, 0x0f0d0f1f, 0x1f1f3f3f, 0x1f1d1f3f, 0x3f3f7f7f, 0x3f3d3fff, 0xffffffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03010300, 0x00000703,
+  0x07050f07, 0x000f0f07, 0x0f0d1f1f, 0x1f1f1f0f, 0x1f1d3f3f, 0x3f3f3f1f, 0x3f3dffff, 0xffffff3f,
+  0x0c0c0000, 0x00000c0c, 0x00000000, 0x00000000, 0x01010000, 0x00000101, 0x03050300, 0x00070303,
+  0x070d0f07, 0x000f0707, 0x0f1d1f1f, 0x1f1f0f0f, 0x1f3d3f3f, 0x3f3f1f1f, 0x3ffdffff, 0xffff3f3f,
+  0x0e0d0000, 0x000c0c0c, 0x05050000, 0x00000000, 0x0b0d0000, 0x00010101, 0x171d0300, 0x00030303,
+  0x2f3d0f07, 0x0f070707, 0x5f7d1f1f, 0x1f0f0f0f, 0xbffd3f3f, 0x3f1f1f1f, 0xfffdffff, 0xff3f3f3f,
+  0x0f0c0000, 0x0c0c0c0f, 0x0f000000, 0x0000080f, 0x0f010000, 0x0101010f, 0x1f050300, 0x0303031f,
+  0x3f0d0f07, 0x0707073f, 0x7f1d1f1f, 0x0f0f0f7f, 0xff3d3f3f, 0x1f1f1fff, 0xfffdffff, 0x3f3f3fff,
+  0x1f1d0000, 0x0c1c1f1f, 0x1f1d0000, 0x00181f1f, 0x1f1d0000, 0x01111f1f, 0x1f1d0300, 0x03031f1f,
+  0x3f3d0f07, 0x07073f3f, 0x7f7d1f1f, 0x0f0f7f7f, 0xfffd3f3f, 0x1f1fffff, 0xfffdffff, 0x3f3fffff,
+  0xfffdfcfc, 0xffffffff, 0xfffdf8f8, 0xffffffff, 0xfffdf1f1, 0xffffffff, 0xfffde3e3, 0xffffffff,
+  0xfffdc7c7, 0xffffffff, 0xfffd8f8f, 0xffffffff, 0xfffd1f1f, 0xffffffff, 0xfffd3f3f, 0xffffffff,
+  0x07040400, 0x00000000, 0x07000000, 0x00000000, 0x07010100, 0x00000000, 0x0f010300, 0x00000007,
+  0x1f050707, 0x00000f0f, 0x3f0d0f07, 0x000f1f1f, 0x7f1d1f1f, 0x1f1f3f3f, 0xff3d3f3f, 0x3f3f7f7f,
+  0x04040000, 0x00000000, 0x00000000, 0x00000000, 0x01010000, 0x00000000, 0x03010300, 0x00000007,
+  0x07050300, 0x0000070f, 0x0f0d0f07, 0x000f0f1f, 0x1f1d1f1f, 0x1f1f1f3f, 0x3f3d3f3f, 0x3f3f3f7f,
+  0x04000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x00000000, 0x03010000, 0x00000003,
+  0x07050300, 0x00000707, 0x0f0d0f07, 0x000f0f0f, 0x1f1d1f1f, 0x1f1f1f1f, 0x3f3d3f3f, 0x3f3f3f3f,
+  0x04000000, 0x00000004, 0x00000000, 0x00000000, 0x01000000, 0x00000001, 0x03010000, 0x00000303,
+  0x07050300, 0x00000707, 0x0f0d0f07, 0x000f0f0f, 0x1f1d1f1f, 0x1f1f1f1f, 0x3f3d3f3f, 0x3f3f3f3f,
+  0x05000000, 0x00000404, 0x02000000, 0x00000000, 0x05000000, 0x00000101, 0x0b010000, 0x00000303,
+  0x17050300, 0x00070707, 0x2f0d0f07, 0x000f0f0f, 0x5f1d1f1f, 0x1f1f1f1f, 0xbf3d3f3f, 0x3f3f3f3f,
+  0x04000000, 0x00040407, 0x00000000, 0x00000007, 0x01000000, 0x00010107, 0x03010000, 0x0003030f,
+  0x07050300, 0x0007071f, 0x0f0d0f07, 0x0f0f0f3f, 0x1f1d1f1f, 0x1f1f1f7f, 0xbf3d3f3f, 0x3f3f3fff,
+  0x0f000000, 0x04040f0f, 0x0f000000, 0x00000f0f, 0x0f000000, 0x01010f0f, 0x0f010000, 0x03030f0f,
+  0x1f050300, 0x07071f1f, 0x3f0d0f07, 0x0f0f3f3f, 0x7f1d1f1f, 0x1f1f7f7f, 0xff3d3f3f, 0x3f3fffff,
+  0xfffbfcfc, 0xffffffff, 0xfffbf8f8, 0xffffffff, 0xfffbf1f1, 0xffffffff, 0xfffbe3e3, 0xffffffff,
+  0xfffbc7c7, 0xffffffff, 0xfffb8f8f, 0xffffffff, 0xfffb1f1f, 0xffffffff, 0xfffb3f3f, 0xffffffff,
+  0xfff8fcfc, 0xffffffff, 0xfff8f8f8, 0xffffffff, 0xfff1f1f1, 0xffffffff, 0xffe3e3e3, 0xffffffff,
+  0xffc3c7c7, 0xffffffff, 0xff8b8f8f, 0xffffffff, 0xff1b1f1f, 0xffffffff, 0xff3b3f3f, 0xffffffff,
+  0x3c383c3e, 0x00003f3f, 0x18181800, 0x0000001e, 0x00000000, 0x00000000, 0x03030300, 0x0000000f,
+  0x0703070f, 0x00001f1f, 0x0f0b0f0f, 0x001f3f3f, 0x1f1b1f3f, 0x3f3f7f7f, 0x3f3b3f7f, 0x7f7fffff,
+  0x3c383c00, 0x00003e3c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x07030700, 0x00000f07, 0x0f0b1f0f, 0x001f1f0f, 0x1f1b3f3f, 0x3f3f3f1f, 0x3f3b7f7f, 0x7f7f7f3f,
+  0x3c3a3c00, 0x003e3c3c, 0x18180000, 0x00001818, 0x00000000, 0x00000000, 0x03030000, 0x00000303,
+  0x070b0700, 0x000f0707, 0x0f1b1f0f, 0x001f0f0f, 0x1f3b3f3f, 0x3f3f1f1f, 0x3f7b7f7f, 0x7f7f3f3f,
+  0x3e3b3c00, 0x003c3c3c, 0x1d1b0000, 0x00181818, 0x0a0a0000, 0x00000000, 0x171b0000, 0x00030303,
+  0x2f3b0700, 0x00070707, 0x5f7b1f0f, 0x1f0f0f0f, 0xbffb3f3f, 0x3f1f1f1f, 0x7ffb7f7f, 0x7f3f3f3f,
+  0x3f3a3c00, 0x3c3c3c3f, 0x1f180000, 0x1818181f, 0x1f000000, 0x0000111f, 0x1f030000, 0x0303031f,
+  0x3f0b0700, 0x0707073f, 0x7f1b1f0f, 0x0f0f0f7f, 0xff3b3f3f, 0x1f1f1fff, 0xff7b7f7f, 0x3f3f3fff,
+  0x3f3b3c00, 0x3c3c3f3f, 0x3f3b0000, 0x18383f3f, 0x3f3b0000, 0x00313f3f, 0x3f3b0000, 0x03233f3f,
+  0x3f3b0700, 0x07073f3f, 0x7f7b1f0f, 0x0f0f7f7f, 0xfffb3f3f, 0x1f1fffff, 0xfffb7f7f, 0x3f3fffff,
+  0xfffbfcfc, 0xffffffff, 0xfffbf8f8, 0xffffffff, 0xfffbf1f1, 0xffffffff, 0xfffbe3e3, 0xffffffff,
+  0xfffbc7c7, 0xffffffff, 0xfffb8f8f, 0xffffffff, 0xfffb1f1f, 0xffffffff, 0xfffb3f3f, 0xffffffff,
+  0x1f181c00, 0x0000001e, 0x0e080800, 0x00000000, 0x0e000000, 0x00000000, 0x0e020200, 0x00000000,
+  0x1f030700, 0x0000000f, 0x3f0b0f0f, 0x00001f1f, 0x7f1b1f0f, 0x001f3f3f, 0xff3b3f3f, 0x3f3f7f7f,
+  0x1c181c00, 0x0000001e, 0x08080000, 0x00000000, 0x00000000, 0x00000000, 0x02020000, 0x00000000,
+  0x07030700, 0x0000000f, 0x0f0b0700, 0x00000f1f, 0x1f1b1f0f, 0x001f1f3f, 0x3f3b3f3f, 0x3f3f3f7f,
+  0x1c180000, 0x0000001c, 0x08000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x00000000,
+  0x07030000, 0x00000007, 0x0f0b0700, 0x00000f0f, 0x1f1b1f0f, 0x001f1f1f, 0x3f3b3f3f, 0x3f3f3f3f,
+  0x1c180000, 0x00001c1c, 0x08000000, 0x00000008, 0x00000000, 0x00000000, 0x02000000, 0x00000002,
+  0x07030000, 0x00000707, 0x0f0b0700, 0x00000f0f, 0x1f1b1f0f, 0x001f1f1f, 0x3f3b3f3f, 0x3f3f3f3f,
+  0x1d180000, 0x00001c1c, 0x0a000000, 0x00000808, 0x04000000, 0x00000000, 0x0a000000, 0x00000202,
+  0x17030000, 0x00000707, 0x2f0b0700, 0x000f0f0f, 0x5f1b1f0f, 0x001f1f1f, 0xbf3b3f3f, 0x3f3f3f3f,
+  0x1c180000, 0x001c1c1f, 0x08000000, 0x0008080e, 0x00000000, 0x0000000e, 0x02000000, 0x0002020e,
+  0x07030000, 0x0007071f, 0x0f0b0700, 0x000f0f3f, 0x1f1b1f0f, 0x1f1f1f7f, 0x3f3b3f3f, 0x3f3f3fff,
+  0x1f180000, 0x1c1c1f1f, 0x1f000000, 0x08081f1f, 0x1f000000, 0x00001f1f, 0x1f000000, 0x02021f1f,
+  0x1f030000, 0x07071f1f, 0x3f0b0700, 0x0f0f3f3f, 0x7f1b1f0f, 0x1f1f7f7f, 0xff3b3f3f, 0x3f3fffff,
+  0xfff7fcfc, 0xffffffff, 0xfff7f8f8, 0xffffffff, 0xfff7f1f1, 0xffffffff, 0xfff7e3e3, 0xffffffff,
+  0xfff7c7c7, 0xffffffff, 0xfff78f8f, 0xffffffff, 0xfff71f1f, 0xffffffff, 0xfff73f3f, 0xffffffff,
+  0xfff4fcfc, 0xffffffff, 0xfff0f8f8, 0xffffffff, 0xfff1f1f1, 0xffffffff, 0xffe3e3e3, 0xffffffff,
+  0xffc7c7c7, 0xffffffff, 0xff878f8f, 0xffffffff, 0xff171f1f, 0xffffffff, 0xff373f3f, 0xffffffff,
+  0xfcf4fcfc, 0x00feffff, 0x7870787c, 0x00007e7e, 0x30303000, 0x0000003c, 0x00000000, 0x00000000,
+  0x06060600, 0x0000001e, 0x0f070f1f, 0x00003f3f, 0x1f171f1f, 0x003f7f7f, 0x3f373f7f, 0x7f7fffff,
+  0xfcf4fefc, 0x00fefefc, 0x78707800, 0x00007c78, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0f070f00, 0x00001f0f, 0x1f173f1f, 0x003f3f1f, 0x3f377f7f, 0x7f7f7f3f,
+  0xfcf6fefc, 0x00fefcfc, 0x78747800, 0x007c7878, 0x30300000, 0x00003030, 0x00000000, 0x00000000,
+  0x06060000, 0x00000606, 0x0f170f00, 0x001f0f0f, 0x1f373f1f, 0x003f1f1f, 0x3f777f7f, 0x7f7f3f3f,
+  0xfef7fefc, 0xfefcfcfc, 0x7d777800, 0x00787878, 0x3a360000, 0x00303030, 0x14140000, 0x00000000,
+  0x2e360000, 0x00060606, 0x5f770f00, 0x000f0f0f, 0xbff73f1f, 0x3f1f1f1f, 0x7ff77f7f, 0x7f3f3f3f,
+  0xfff6fefc, 0xfcfcfcff, 0x7f747800, 0x7878787f, 0x3e300000, 0x3030303e, 0x3e000000, 0x0000223e,
+  0x3e060000, 0x0606063e, 0x7f170f00, 0x0f0f0f7f, 0xff373f1f, 0x1f1f1fff, 0xff777f7f, 0x3f3f3fff,
+  0xfff7fefc, 0xfcfcffff, 0x7f777800, 0x78787f7f, 0x7f770000, 0x30717f7f, 0x7f770000, 0x00637f7f,
+  0x7f770000, 0x06477f7f, 0x7f770f00, 0x0f0f7f7f, 0xfff73f1f, 0x1f1fffff, 0xfff77f7f, 0x3f3fffff,
+  0xfff7fcfc, 0xffffffff, 0xfff7f8f8, 0xffffffff, 0xfff7f1f1, 0xffffffff, 0xfff7e3e3, 0xffffffff,
+  0xfff7c7c7, 0xffffffff, 0xfff78f8f, 0xffffffff, 0xfff71f1f, 0xffffffff, 0xfff73f3f, 0xffffffff,
+  0x7f747c7c, 0x00007e7e, 0x3e303800, 0x0000003c, 0x1c101000, 0x00000000, 0x1c000000, 0x00000000,
+  0x1c040400, 0x00000000, 0x3e060e00, 0x0000001e, 0x7f171f1f, 0x00003f3f, 0xff373f1f, 0x003f7f7f,
+  0x7c747800, 0x00007c7e, 0x38303800, 0x0000003c, 0x10100000, 0x00000000, 0x00000000, 0x00000000,
+  0x04040000, 0x00000000, 0x0e060e00, 0x0000001e, 0x1f170f00, 0x00001f3f, 0x3f373f1f, 0x003f3f7f,
+  0x7c747800, 0x00007c7c, 0x38300000, 0x00000038, 0x10000000, 0x00000000, 0x00000000, 0x00000000,
+  0x04000000, 0x00000000, 0x0e060000, 0x0000000e, 0x1f170f00, 0x00001f1f, 0x3f373f1f, 0x003f3f3f,
+  0x7c747800, 0x00007c7c, 0x38300000, 0x00003838, 0x10000000, 0x00000010, 0x00000000, 0x00000000,
+  0x04000000, 0x00000004, 0x0e060000, 0x00000e0e, 0x1f170f00, 0x00001f1f, 0x3f373f1f, 0x003f3f3f,
+  0x7d747800, 0x007c7c7c, 0x3a300000, 0x00003838, 0x14000000, 0x00001010, 0x08000000, 0x00000000,
+  0x14000000, 0x00000404, 0x2e060000, 0x00000e0e, 0x5f170f00, 0x001f1f1f, 0xbf373f1f, 0x003f3f3f,
+  0x7c747800, 0x007c7c7f, 0x38300000, 0x0038383e, 0x10000000, 0x0010101c, 0x00000000, 0x0000001c,
+  0x04000000, 0x0004041c, 0x0e060000, 0x000e0e3e, 0x1f170f00, 0x001f1f7f, 0x3f373f1f, 0x3f3f3fff,
+  0x7f747800, 0x7c7c7f7f, 0x3e300000, 0x38383e3e, 0x3e000000, 0x10103e3e, 0x3e000000, 0x00003e3e,
+  0x3e000000, 0x04043e3e, 0x3e060000, 0x0e0e3e3e, 0x7f170f00, 0x1f1f7f7f, 0xff373f1f, 0x3f3fffff,
+  0xfffffcfc, 0xffffffff, 0xfffff8f8, 0xffffffff, 0xfffff0f1, 0xffffffff, 0xffffe2e3, 0xffffffff,
+  0xffffc6c7, 0xffffffff, 0xffff8e8f, 0xffffffff, 0xffff1e1f, 0xffffffff, 0xffff3e3f, 0xffffffff,
+  0x00000000, 0x00000000, 0xfff8f8f8, 0xffffffff, 0xfff1f0f1, 0xffffffff, 0xffe3e2e3, 0xffffffff,
+  0xffc7c6c7, 0xffffffff, 0xff8f8e8f, 0xffffffff, 0xff1f1e1f, 0xffffffff, 0xff3f3e3f, 0xffffffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x00000f0f, 0x03030200, 0x00071f1f,
+  0x07070600, 0x0f0f3f3f, 0x0f0f0e00, 0x1f1f7f7f, 0x1f1f1eff, 0xffffffff, 0x3f3f3eff, 0xffffffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200, 0x03030000, 0x00070703,
+  0x07070000, 0x0f0f0f07, 0x0f0f0000, 0x1f1f1f0f, 0x1f1ffeff, 0xffffff1f, 0x3f3ffeff, 0xffffff3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03000000, 0x00070303,
+  0x07000000, 0x0f0f0707, 0x0f000000, 0x1f1f0f0f, 0x1ffffeff, 0xffff1f1f, 0x3ffffeff, 0xffff3f3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00030303,
+  0x00000000, 0x0f070707, 0x1f000000, 0x1f0f0f0f, 0xfffffeff, 0xff1f1f1f, 0xfffffeff, 0xff3f3f3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03030300,
+  0x00000000, 0x0707070f, 0x1f000000, 0x0f0f0f1f, 0xfffffeff, 0x1f1f1fff, 0xfffffeff, 0x3f3f3fff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03030700,
+  0x00000000, 0x07070f0f, 0x1f000000, 0x0f0f1f1f, 0xfffffeff, 0x1f1fffff, 0xfffffeff, 0x3f3fffff,
+  0x00030000, 0x00000000, 0x00030000, 0x00000000, 0xfffff0f1, 0xffffffff, 0xffffe2e3, 0xffffffff,
+  0xffffc6c7, 0xffffffff, 0xffff8e8f, 0xffffffff, 0xffff1e1f, 0xffffffff, 0xffff3e3f, 0xffffffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0f000000, 0x00000f0f, 0x0f020200, 0x00000f0f,
+  0x1f070600, 0x00071f1f, 0x3f0f0e00, 0x0f0f3f3f, 0x7f1f1e00, 0x1f1f7f7f, 0xff3f3e3f, 0xffffffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000006, 0x02020000, 0x0000020e,
+  0x07070000, 0x0007071f, 0x0f0f0000, 0x0f0f0f3f, 0x1f1f0000, 0x1f1f1f7f, 0x3f3f3eff, 0xffffffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02000000, 0x00000202,
+  0x07000000, 0x00070707, 0x0f000000, 0x0f0f0f0f, 0x1f000000, 0x1f1f1f1f, 0x3f3ffeff, 0xffffff3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000202,
+  0x00000000, 0x00070707, 0x00000000, 0x0f0f0f0f, 0x1f000000, 0x1f1f1f1f, 0x3ffffeff, 0xffff3f3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000200,
+  0x00000000, 0x00070700, 0x00000000, 0x0f0f0f0f, 0x1f000000, 0x1f1f1f1f, 0xfffffeff, 0xff3f3f3f,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00020000,
+  0x00000000, 0x00070700, 0x00000000, 0x0f0f0f0f, 0x1f000000, 0x1f1f1f1f, 0xfffffeff, 0x3f3f3fff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02020000,
+  0x00000000, 0x07070700, 0x00000000, 0x0f0f0f0f, 0x1f000000, 0x1f1f1f1f, 0xfffffeff, 0x3f3fffff,
+  0xfffffcfc, 0xffffffff, 0xfffff8f8, 0xffffffff, 0xfffff1f1, 0xffffffff, 0xffffe1e3, 0xffffffff,
+  0xffffc5c7, 0xffffffff, 0xffff8d8f, 0xffffffff, 0xffff1d1f, 0xffffffff, 0xffff3d3f, 0xffffffff,
+  0xfffcfcfc, 0xffffffff, 0x00000000, 0x00000000, 0xfff1f1f1, 0xffffffff, 0xffe3e1e3, 0xffffffff,
+  0xffc7c5c7, 0xffffffff, 0xff8f8d8f, 0xffffffff, 0xff1f1d1f, 0xffffffff, 0xff3f3d3f, 0xffffffff,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03030103, 0x00001f1f,
+  0x0707050f, 0x000f3f3f, 0x0f0f0d1f, 0x1f1f7f7f, 0x1f1f1d3f, 0x3f3fffff, 0x3f3f3dff, 0xffffffff,
+  0x0c0c0c00, 0x0000000c, 0x00000000, 0x00000000, 0x01010100, 0x00000001, 0x03030503, 0x00000703,
+  0x07070d0f, 0x000f0f07, 0x0f0f1d1f, 0x1f1f1f0f, 0x1f1f3d3f, 0x3f3f3f1f, 0x3f3ffdff, 0xffffff3f,
+  0x0c0e0d00, 0x00000c0c, 0x00050500, 0x00000000, 0x010b0d00, 0x00000101, 0x03171d03, 0x00000303,
+  0x072f3d0f, 0x000f0707, 0x0f5f7d1f, 0x1f1f0f0f, 0x1fbffd3f, 0x3f3f1f1f, 0x3ffffdff, 0xffff3f3f,
+  0x0f0f0c00, 0x000c0c0c, 0x0f0f0000, 0x00000008, 0x0f0f0100, 0x00010101, 0x1f1f0503, 0x00030303,
+  0x3f3f0d0f, 0x00070707, 0x7f7f1d1f, 0x1f0f0f0f, 0xffff3d3f, 0x3f1f1f1f, 0xfffffdff, 0xff3f3f3f,
+  0x1f1f1d00, 0x0c0c1c1f, 0x1f1f1d00, 0x0000181f, 0x1f1f1d00, 0x0101111f, 0x1f1f1d03, 0x0303031f,
+  0x3f3f3d0f, 0x0707073f, 0x7f7f7d1f, 0x0f0f0f7f, 0xfffffd3f, 0x1f1f1fff, 0xfffffdff, 0x3f3f3fff,
+  0x3f3f3d3f, 0x0c3c3f3f, 0x3f3f3d3f, 0x00383f3f, 0x3f3f3d3f, 0x01313f3f, 0x3f3f3d3f, 0x03233f3f,
+  0x3f3f3d3f, 0x07073f3f, 0x7f7f7d7f, 0x0f0f7f7f, 0xfffffdff, 0x1f1fffff, 0xfffffdff, 0x3f3fffff,
+  0x00070404, 0x00000000, 0x00070000, 0x00000000, 0x00070101, 0x00000000, 0xffffe1e3, 0xffffffff,
+  0xffffc5c7, 0xffffffff, 0xffff8d8f, 0xffffffff, 0xffff1d1f, 0xffffffff, 0xffff3d3f, 0xffffffff,
+  0x00040400, 0x00000000, 0x00000000, 0x00000000, 0x00010100, 0x00000000, 0x1f030103, 0x00001f1f,
+  0x1f070503, 0x00001f1f, 0x3f0f0d0f, 0x000f3f3f, 0x7f1f1d1f, 0x1f1f7f7f, 0xff3f3d3f, 0x3f3fffff,
+  0x00040000, 0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00000000, 0x03030100, 0x0000000f,
+  0x07070503, 0x0000071f, 0x0f0f0d0f, 0x000f0f3f, 0x1f1f1d1f, 0x1f1f1f7f, 0x3f3f3d3f, 0x3f3f3fff,
+  0x04040000, 0x00000000, 0x00000000, 0x00000000, 0x01010000, 0x00000000, 0x03030100, 0x00000003,
+  0x07070503, 0x00000707, 0x0f0f0d0f, 0x000f0f0f, 0x1f1f1d1f, 0x1f1f1f1f, 0x3f3f3d3f, 0x3f3f3f3f,
+  0x04050000, 0x00000004, 0x00020000, 0x00000000, 0x01050000, 0x00000001, 0x030b0100, 0x00000003,
+  0x07170503, 0x00000707, 0x0f2f0d0f, 0x000f0f0f, 0x1f5f1d1f, 0x1f1f1f1f, 0x3fbf3d3f, 0x3f3f3f3f,
+  0x07040000, 0x00000404, 0x07000000, 0x00000000, 0x07010000, 0x00000101, 0x0f030100, 0x00000303,
+  0x1f070503, 0x00000707, 0x3f0f0d0f, 0x000f0f0f, 0x7f1f1d1f, 0x1f1f1f1f, 0xffbf3d3f, 0x3f3f3f3f,
+  0x0f0f0000, 0x0004040f, 0x0f0f0000, 0x0000000f, 0x0f0f0000, 0x0001010f, 0x0f0f0100, 0x0003030f,
+  0x1f1f0503, 0x0007071f, 0x3f3f0d0f, 0x000f0f3f, 0x7f7f1d1f, 0x1f1f1f7f, 0xffff3d3f, 0x3f3f3fff,
+  0x1f1f1d00, 0x04041f1f, 0x1f1f1d00, 0x00001f1f, 0x1f1f1d00, 0x01011f1f, 0x1f1f1d00, 0x03031f1f,
+  0x1f1f1d03, 0x07071f1f, 0x3f3f3d0f, 0x0f0f3f3f, 0x7f7f7d1f, 0x1f1f7f7f, 0xfffffd3f, 0x3f3fffff,
+  0xfffff8fc, 0xffffffff, 0xfffff8f8, 0xffffffff, 0xfffff1f1, 0xffffffff, 0xffffe3e3, 0xffffffff,
+  0xffffc3c7, 0xffffffff, 0xffff8b8f, 0xffffffff, 0xffff1b1f, 0xffffffff, 0xffff3b3f, 0xffffffff,
+  0xfffcf8fc, 0xffffffff, 0xfff8f8f8, 0xffffffff, 0x00000000, 0x00000000, 0xffe3e3e3, 0xffffffff,
+  0xffc7c3c7, 0xffffffff, 0xff8f8b8f, 0xffffffff, 0xff1f1b1f, 0xffffffff, 0xff3f3b3f, 0xffffffff,
+  0x3c3c383c, 0x00003f3f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x07070307, 0x00003f3f, 0x0f0f0b1f, 0x001f7f7f, 0x1f1f1b3f, 0x3f3fffff, 0x3f3f3b7f, 0x7f7fffff,
+  0x3c3c3a3c, 0x00003e3c, 0x18181800, 0x00000018, 0x00000000, 0x00000000, 0x03030300, 0x00000003,
+  0x07070b07, 0x00000f07, 0x0f0f1b1f, 0x001f1f0f, 0x1f1f3b3f, 0x3f3f3f1f, 0x3f3f7b7f, 0x7f7f7f3f,
+  0x3c3e3b3c, 0x00003c3c, 0x181d1b00, 0x00001818, 0x000a0a00, 0x00000000, 0x03171b00, 0x00000303,
+  0x072f3b07, 0x00000707, 0x0f5f7b1f, 0x001f0f0f, 0x1fbffb3f, 0x3f3f1f1f, 0x3f7ffb7f, 0x7f7f3f3f,
+  0x3f3f3a3c, 0x003c3c3c, 0x1f1f1800, 0x00181818, 0x1f1f0000, 0x00000011, 0x1f1f0300, 0x00030303,
+  0x3f3f0b07, 0x00070707, 0x7f7f1b1f, 0x000f0f0f, 0xffff3b3f, 0x3f1f1f1f, 0xffff7b7f, 0x7f3f3f3f,
+  0x3f3f3b3c, 0x3c3c3c3f, 0x3f3f3b00, 0x1818383f, 0x3f3f3b00, 0x0000313f, 0x3f3f3b00, 0x0303233f,
+  0x3f3f3b07, 0x0707073f, 0x7f7f7b1f, 0x0f0f0f7f, 0xfffffb3f, 0x1f1f1fff, 0xfffffb7f, 0x3f3f3fff,
+  0x7f7f7b7f, 0x3c7c7f7f, 0x7f7f7b7f, 0x18787f7f, 0x7f7f7b7f, 0x00717f7f, 0x7f7f7b7f, 0x03637f7f,
+  0x7f7f7b7f, 0x07477f7f, 0x7f7f7b7f, 0x0f0f7f7f, 0xfffffbff, 0x1f1fffff, 0xfffffbff, 0x3f3fffff,
+  0xfffff8fc, 0xffffffff, 0x000e0808, 0x00000000, 0x000e0000, 0x00000000, 0x000e0202, 0x00000000,
+  0xffffc3c7, 0xffffffff, 0xffff8b8f, 0xffffffff, 0xffff1b1f, 0xffffffff, 0xffff3b3f, 0xffffffff,
+  0x3f3c383c, 0x00003f3f, 0x00080800, 0x00000000, 0x00000000, 0x00000000, 0x00020200, 0x00000000,
+  0x3f070307, 0x00003f3f, 0x3f0f0b07, 0x00003f3f, 0x7f1f1b1f, 0x001f7f7f, 0xff3f3b3f, 0x3f3fffff,
+  0x1c1c1800, 0x0000001f, 0x00080000, 0x00000000, 0x00000000, 0x00000000, 0x00020000, 0x00000000,
+  0x07070300, 0x0000001f, 0x0f0f0b07, 0x00000f3f, 0x1f1f1b1f, 0x001f1f7f, 0x3f3f3b3f, 0x3f3f3fff,
+  0x1c1c1800, 0x0000001c, 0x08080000, 0x00000000, 0x00000000, 0x00000000, 0x02020000, 0x00000000,
+  0x07070300, 0x00000007, 0x0f0f0b07, 0x00000f0f, 0x1f1f1b1f, 0x001f1f1f, 0x3f3f3b3f, 0x3f3f3f3f,
+  0x1c1d1800, 0x0000001c, 0x080a0000, 0x00000008, 0x00040000, 0x00000000, 0x020a0000, 0x00000002,
+  0x07170300, 0x00000007, 0x0f2f0b07, 0x00000f0f, 0x1f5f1b1f, 0x001f1f1f, 0x3fbf3b3f, 0x3f3f3f3f,
+  0x1f1c1800, 0x00001c1c, 0x0e080000, 0x00000808, 0x0e000000, 0x00000000, 0x0e020000, 0x00000202,
+  0x1f070300, 0x00000707, 0x3f0f0b07, 0x00000f0f, 0x7f1f1b1f, 0x001f1f1f, 0xff3f3b3f, 0x3f3f3f3f,
+  0x1f1f1800, 0x001c1c1f, 0x1f1f0000, 0x0008081f, 0x1f1f0000, 0x0000001f, 0x1f1f0000, 0x0002021f,
+  0x1f1f0300, 0x0007071f, 0x3f3f0b07, 0x000f0f3f, 0x7f7f1b1f, 0x001f1f7f, 0xffff3b3f, 0x3f3f3fff,
+  0x3f3f3b00, 0x1c1c3f3f, 0x3f3f3b00, 0x08083f3f, 0x3f3f3b00, 0x00003f3f, 0x3f3f3b00, 0x02023f3f,
+  0x3f3f3b00, 0x07073f3f, 0x3f3f3b07, 0x0f0f3f3f, 0x7f7f7b1f, 0x1f1f7f7f, 0xfffffb3f, 0x3f3fffff,
+  0xfffff4fc, 0xffffffff, 0xfffff0f8, 0xffffffff, 0xfffff1f1, 0xffffffff, 0xffffe3e3, 0xffffffff,
+  0xffffc7c7, 0xffffffff, 0xffff878f, 0xffffffff, 0xffff171f, 0xffffffff, 0xffff373f, 0xffffffff,
+  0xfffcf4fc, 0xffffffff, 0xfff8f0f8, 0xffffffff, 0xfff1f1f1, 0xffffffff, 0x00000000, 0x00000000,
+  0xffc7c7c7, 0xffffffff, 0xff8f878f, 0xffffffff, 0xff1f171f, 0xffffffff, 0xff3f373f, 0xffffffff,
+  0xfcfcf4fe, 0x00feffff, 0x78787078, 0x00007f7f, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0x00000000, 0x00000000, 0x0f0f070f, 0x00007f7f, 0x1f1f173f, 0x003fffff, 0x3f3f377f, 0x7f7fffff,
+  0xfcfcf6fe, 0x00fefefc, 0x78787478, 0x00007c78, 0x30303000, 0x00000030, 0x00000000, 0x00000000,
+  0x06060600, 0x00000006, 0x0f0f170f, 0x00001f0f, 0x1f1f373f, 0x003f3f1f, 0x3f3f777f, 0x7f7f7f3f,
+  0xfcfef7fe, 0x00fefcfc, 0x787d7778, 0x00007878, 0x303a3600, 0x00003030, 0x00141400, 0x00000000,
+  0x062e3600, 0x00000606, 0x0f5f770f, 0x00000f0f, 0x1fbff73f, 0x003f1f1f, 0x3f7ff77f, 0x7f7f3f3f,
+  0xfffff6fe, 0x00fcfcfc, 0x7f7f7478, 0x00787878, 0x3e3e3000, 0x00303030, 0x3e3e0000, 0x00000022,
+  0x3e3e0600, 0x00060606, 0x7f7f170f, 0x000f0f0f, 0xffff373f, 0x001f1f1f, 0xffff777f, 0x7f3f3f3f,
+  0xfffff7fe, 0xfcfcfcff, 0x7f7f7778, 0x7878787f, 0x7f7f7700, 0x3030717f, 0x7f7f7700, 0x0000637f,
+  0x7f7f7700, 0x0606477f, 0x7f7f770f, 0x0f0f0f7f, 0xfffff73f, 0x1f1f1fff, 0xfffff77f, 0x3f3f3fff,
+  0xfffff7ff, 0xfcfcffff, 0xfffff7ff, 0x78f8ffff, 0xfffff7ff, 0x30f1ffff, 0xfffff7ff, 0x00e3ffff,
+  0xfffff7ff, 0x06c7ffff, 0xfffff7ff, 0x0f8fffff, 0xfffff7ff, 0x1f1fffff, 0xfffff7ff, 0x3f3fffff,
+  0xfffff4fc, 0xffffffff, 0xfffff0f8, 0xffffffff, 0x001c1010, 0x00000000, 0x001c0000, 0x00000000,
+  0x001c0404, 0x00000000, 0xffff878f, 0xffffffff, 0xffff171f, 0xffffffff, 0xffff373f, 0xffffffff,
+  0x7f7c7478, 0x00007f7f, 0x7f787078, 0x00007f7f, 0x00101000, 0x00000000, 0x00000000, 0x00000000,
+  0x00040400, 0x00000000, 0x7f0f070f, 0x00007f7f, 0x7f1f170f, 0x00007f7f, 0xff3f373f, 0x003fffff,
+  0x7c7c7478, 0x00007c7f, 0x38383000, 0x0000003e, 0x00100000, 0x00000000, 0x00000000, 0x00000000,
+  0x00040000, 0x00000000, 0x0e0e0600, 0x0000003e, 0x1f1f170f, 0x00001f7f, 0x3f3f373f, 0x003f3fff,
+  0x7c7c7478, 0x00007c7c, 0x38383000, 0x00000038, 0x10100000, 0x00000000, 0x00000000, 0x00000000,
+  0x04040000, 0x00000000, 0x0e0e0600, 0x0000000e, 0x1f1f170f, 0x00001f1f, 0x3f3f373f, 0x003f3f3f,
+  0x7c7d7478, 0x00007c7c, 0x383a3000, 0x00000038, 0x10140000, 0x00000010, 0x00080000, 0x00000000,
+  0x04140000, 0x00000004, 0x0e2e0600, 0x0000000e, 0x1f5f170f, 0x00001f1f, 0x3fbf373f, 0x003f3f3f,
+  0x7f7c7478, 0x00007c7c, 0x3e383000, 0x00003838, 0x1c100000, 0x00001010, 0x1c000000, 0x00000000,
+  0x1c040000, 0x00000404, 0x3e0e0600, 0x00000e0e, 0x7f1f170f, 0x00001f1f, 0xff3f373f, 0x003f3f3f,
+  0x7f7f7478, 0x007c7c7f, 0x3e3e3000, 0x0038383e, 0x3e3e0000, 0x0010103e, 0x3e3e0000, 0x0000003e,
+  0x3e3e0000, 0x0004043e, 0x3e3e0600, 0x000e0e3e, 0x7f7f170f, 0x001f1f7f, 0xffff373f, 0x003f3fff,
+  0x7f7f7778, 0x7c7c7f7f, 0x7f7f7700, 0x38387f7f, 0x7f7f7700, 0x10107f7f, 0x7f7f7700, 0x00007f7f,
+  0x7f7f7700, 0x04047f7f, 0x7f7f7700, 0x0e0e7f7f, 0x7f7f770f, 0x1f1f7f7f, 0xfffff73f, 0x3f3fffff
+};
+
+}
@@ -0,0 +1,42 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2014 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TABLES_H_INCLUDED
+#define TABLES_H_INCLUDED
+
+#include "types.h"
+
+/// Lookup tables that are expensive to compute at startup: the magic numbers of
+/// the sliding attacks and the KPK bitbase. They are computed at build time by
+/// gentables into tables.cpp, and Precomputed is false when the build uses the
+/// empty ones of notables.cpp instead (precompute=no in the Makefile), in
+/// which case they are computed at startup as usual.
+
+namespace Tables {
+
+const unsigned KPKBitbaseSize = 2 * 24 * 64 * 64 / 32; // See bitbase.cpp
+
+extern const bool Precomputed;
+extern const Bitboard RookMagics[SQUARE_NB];
+extern const Bitboard BishopMagics[SQUARE_NB];
+extern const uint32_t KPKBitbase[KPKBitbaseSize];
+
+}
+
+#endif // #ifndef TABLES_H_INCLUDED
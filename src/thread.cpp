@@ -20,6 +20,7 @@
 #include <algorithm> // For std::count
 #include <cassert>
 
+#include "engine.h"
 #include "movegen.h"
 #include "search.h"
 #include "thread.h"
@@ -27,9 +28,7 @@
 
 using namespace Search;
 
-ThreadPool Threads; // Global object
-
-extern void check_time();
+extern void check_time(Engine& e);
 
 namespace {
 
@@ -43,8 +42,8 @@ namespace {
  // outside Thread c'tor and d'tor because the object will be fully initialized
  // when start_routine (and hence virtual idle_loop) is called and when joining.
 
- template<typename T> T* new_thread() {
-   T* th = new T();
+ template<typename T> T* new_thread(Engine* e) {
+   T* th = new T(e);
    thread_create(th->handle, start_routine, th); // Will go to sleep
    return th;
  }
@@ -82,13 +81,14 @@ void ThreadBase::wait_for(volatile const bool& b) {
 // Thread c'tor just inits data and does not launch any execution thread.
 // Such a thread will only be started when c'tor returns.
 
-Thread::Thread() /* : splitPoints() */ { // Value-initialization bug in MSVC
+Thread::Thread(Engine* e) : ThreadBase(e) /* , splitPoints() */ { // Value-initialization bug in MSVC
 
   searching = false;
-  maxPly = splitPointsSize = 0;
+  maxPly = splitPointsSize = pollCalls = pollInterval = 0;
+  lastPollTime = 0;
   activeSplitPoint = NULL;
   activePosition = NULL;
-  idx = Threads.size(); // Starts from 0
+  idx = e->threads.size(); // Starts from 0
 }
 
 
@@ -142,7 +142,7 @@ void TimerThread::idle_loop() {
       mutex.unlock();
 
       if (run)
-          check_time();
+          check_time(*engine);
   }
 }
 
@@ -160,7 +160,7 @@ void MainThread::idle_loop() {
 
       while (!thinking && !exit)
       {
-          Threads.sleepCondition.notify_one(); // Wake up the UI thread if needed
+          engine->threads.sleepCondition.notify_one(); // Wake up the UI thread if needed
           sleepCondition.wait(mutex);
       }
 
@@ -171,7 +171,7 @@ void MainThread::idle_loop() {
 
       searching = true;
 
-      Search::think();
+      Search::think(*engine);
 
       assert(searching);
 
@@ -180,16 +180,18 @@ void MainThread::idle_loop() {
 }
 
 
-// init() is called at startup to create and launch requested threads, that will
-// go immediately to sleep. We cannot use a c'tor because Threads is a static
-// object and we need a fully initialized engine at this point due to allocation
-// of Endgames in Thread c'tor.
+// init() is called by Engine::init() to create and launch requested threads, that
+// will go immediately to sleep. We cannot use a c'tor because ThreadPool is part
+// of the engine and we need a fully initialized engine at this point, also due
+// to allocation of Endgames in Thread c'tor.
 
-void ThreadPool::init() {
+void ThreadPool::init(Engine* e, size_t requested) {
 
-  timer = new_thread<TimerThread>();
-  push_back(new_thread<MainThread>());
-  read_uci_options();
+  engine = e;
+  evalHashMb = Options["Eval Hash"];
+  timer = new_thread<TimerThread>(engine);
+  push_back(new_thread<MainThread>(engine));
+  set_size(requested);
 }
 
 
@@ -206,15 +208,22 @@ void ThreadPool::exit() {
 
 
 // read_uci_options() updates internal threads parameters from the corresponding
-// UCI options and creates/destroys threads to match the requested number. Thread
-// objects are dynamically allocated to avoid creating all possible threads
-// in advance (which include pawns and material tables), even if only a few
-// are to be used.
+// UCI options and creates/destroys threads to match the requested number.
 
 void ThreadPool::read_uci_options() {
 
+  set_size(Options["Threads"]);
+}
+
+
+// set_size() creates/destroys threads to match the requested number and sizes
+// their evaluation caches, see set_eval_hash(). Thread objects are
+// dynamically allocated to avoid creating all possible threads in advance
+// (which include pawns and material tables), even if only a few are to be used.
+
+void ThreadPool::set_size(size_t requested) {
+
   minimumSplitDepth = Options["Min Split Depth"] * ONE_PLY;
-  size_t requested  = Options["Threads"];
 
   assert(requested > 0);
 
@@ -223,13 +232,28 @@ void ThreadPool::read_uci_options() {
       minimumSplitDepth = requested < 8 ? 4 * ONE_PLY : 7 * ONE_PLY;
 
   while (size() < requested)
-      push_back(new_thread<Thread>());
+      push_back(new_thread<Thread>(engine));
 
   while (size() > requested)
   {
       delete_thread(back());
       pop_back();
   }
+
+  set_eval_hash(evalHashMb);
+}
+
+
+// set_eval_hash() sets the size in MB of the evaluation cache of each thread.
+// It starts from the "Eval Hash" option, but is kept per pool so that engines
+// of the same program can use different sizes.
+
+void ThreadPool::set_eval_hash(size_t mbSize) {
+
+  evalHashMb = mbSize;
+
+  for (iterator it = begin(); it != end(); ++it)
+      (*it)->evalTable.resize(evalHashMb);
 }
 
 
@@ -253,15 +277,16 @@ Thread* ThreadPool::available_slave(const Thread* master) const {
 // data that must be copied to the helper threads and then helper threads are
 // told that they have been assigned work. This will cause them to instantly
 // leave their idle loops and call search(). When all threads have returned from
-// search() then split() returns.
+// search() then split() returns, with the moves tried by all the threads
+// added to 'moveCount'.
 
 void Thread::split(Position& pos, const Stack* ss, Value alpha, Value beta, Value* bestValue,
-                   Move* bestMove, Depth depth, int moveCount,
+                   Move* bestMove, Depth depth, int* moveCount,
                    MovePicker* movePicker, int nodeType, bool cutNode) {
 
   assert(pos.pos_is_ok());
   assert(-VALUE_INFINITE < *bestValue && *bestValue <= alpha && alpha < beta && beta <= VALUE_INFINITE);
-  assert(depth >= Threads.minimumSplitDepth);
+  assert(depth >= engine->threads.minimumSplitDepth);
   assert(searching);
   assert(splitPointsSize < MAX_SPLITPOINTS_PER_THREAD);
 
@@ -279,7 +304,7 @@ void Thread::split(Position& pos, const Stack* ss, Value alpha, Value beta, Valu
   sp.nodeType = nodeType;
   sp.cutNode = cutNode;
   sp.movePicker = movePicker;
-  sp.moveCount = moveCount;
+  sp.moveCount = *moveCount;
   sp.pos = &pos;
   sp.nodes = 0;
   sp.cutoff = false;
@@ -288,7 +313,7 @@ void Thread::split(Position& pos, const Stack* ss, Value alpha, Value beta, Valu
   // Try to allocate available threads and ask them to start searching setting
   // 'searching' flag. This must be done under lock protection to avoid concurrent
   // allocation of the same slave by another master.
-  Threads.mutex.lock();
+  engine->threads.mutex.lock();
   sp.mutex.lock();
 
   sp.allSlavesSearching = true; // Must be set under lock protection
@@ -296,7 +321,7 @@ void Thread::split(Position& pos, const Stack* ss, Value alpha, Value beta, Valu
   activeSplitPoint = &sp;
   activePosition = NULL;
 
-  for (Thread* slave; (slave = Threads.available_slave(this)) != NULL; )
+  for (Thread* slave; (slave = engine->threads.available_slave(this)) != NULL; )
   {
       sp.slavesMask.set(slave->idx);
       slave->activeSplitPoint = &sp;
@@ -309,7 +334,7 @@ void Thread::split(Position& pos, const Stack* ss, Value alpha, Value beta, Valu
   // The thread will return from the idle loop when all slaves have finished
   // their work at this split point.
   sp.mutex.unlock();
-  Threads.mutex.unlock();
+  engine->threads.mutex.unlock();
 
   Thread::idle_loop(); // Force a call to base class idle_loop()
 
@@ -322,7 +347,7 @@ void Thread::split(Position& pos, const Stack* ss, Value alpha, Value beta, Valu
   // We have returned from the idle loop, which means that all threads are
   // finished. Note that setting 'searching' and decreasing splitPointsSize is
   // done under lock protection to avoid a race with Thread::available_to().
-  Threads.mutex.lock();
+  engine->threads.mutex.lock();
   sp.mutex.lock();
 
   searching = true;
@@ -332,9 +357,10 @@ void Thread::split(Position& pos, const Stack* ss, Value alpha, Value beta, Valu
   pos.set_nodes_searched(pos.nodes_searched() + sp.nodes);
   *bestMove = sp.bestMove;
   *bestValue = sp.bestValue;
+  *moveCount = sp.moveCount;
 
   sp.mutex.unlock();
-  Threads.mutex.unlock();
+  engine->threads.mutex.unlock();
 }
 
 // wait_for_think_finished() waits for main thread to go to sleep then returns
@@ -355,24 +381,24 @@ void ThreadPool::start_thinking(const Position& pos, const LimitsType& limits, S
 
   wait_for_think_finished();
 
-  SearchTime = Time::now(); // As early as possible
+  engine->searchTime = Time::now(); // As early as possible
 
-  Signals.stopOnPonderhit = Signals.firstRootMove = false;
-  Signals.stop = Signals.failedLowAtRoot = false;
+  engine->signals.stopOnPonderhit = engine->signals.firstRootMove = false;
+  engine->signals.stop = engine->signals.failedLowAtRoot = false;
 
-  RootMoves.clear();
-  RootPos = pos;
-  Limits = limits;
+  engine->rootMoves.clear();
+  engine->rootPos = pos;
+  engine->limits = limits;
   if (states.get()) // If we don't set a new position, preserve current state
   {
-      SetupStates = states; // Ownership transfer here
+      engine->setupStates = states; // Ownership transfer here
       assert(!states.get());
   }
 
   for (MoveList<LEGAL> it(pos); *it; ++it)
       if (   limits.searchmoves.empty()
           || std::count(limits.searchmoves.begin(), limits.searchmoves.end(), *it))
-          RootMoves.push_back(RootMove(*it));
+          engine->rootMoves.push_back(RootMove(*it));
 
   main()->thinking = true;
   main()->notify_one(); // Starts main thread
@@ -23,6 +23,7 @@
 #include <bitset>
 #include <vector>
 
+#include "evaluate.h"
 #include "material.h"
 #include "movepick.h"
 #include "pawns.h"
@@ -57,6 +58,7 @@ private:
   WaitCondition c;
 };
 
+struct Engine;
 struct Thread;
 
 struct SplitPoint {
@@ -92,12 +94,13 @@ struct SplitPoint {
 
 struct ThreadBase {
 
-  ThreadBase() : handle(NativeHandle()), exit(false) {}
+  ThreadBase(Engine* e) : engine(e), handle(NativeHandle()), exit(false) {}
   virtual ~ThreadBase() {}
   virtual void idle_loop() = 0;
   void notify_one();
   void wait_for(volatile const bool& b);
 
+  Engine* engine;
   Mutex mutex;
   ConditionVariable sleepCondition;
   NativeHandle handle;
@@ -106,27 +109,32 @@ struct ThreadBase {
 
 
 /// Thread struct keeps together all the thread related stuff like locks, state
-/// and especially split points. We also use per-thread pawn and material hash
-/// tables so that once we get a pointer to an entry its life time is unlimited
+/// and especially split points. We also use per-thread pawn, material and eval
+/// hash tables so that once we get a pointer to an entry its life time is unlimited
 /// and we don't have to care about someone changing the entry under our feet.
 
 struct Thread : public ThreadBase {
 
-  Thread();
+  Thread(Engine* e);
   virtual void idle_loop();
   bool cutoff_occurred() const;
   bool available_to(const Thread* master) const;
 
   void split(Position& pos, const Search::Stack* ss, Value alpha, Value beta, Value* bestValue, Move* bestMove,
-             Depth depth, int moveCount, MovePicker* movePicker, int nodeType, bool cutNode);
+             Depth depth, int* moveCount, MovePicker* movePicker, int nodeType, bool cutNode);
 
   SplitPoint splitPoints[MAX_SPLITPOINTS_PER_THREAD];
   Material::Table materialTable;
   Endgames endgames;
   Pawns::Table pawnsTable;
+  Eval::Table evalTable;
+  Eval::Stats evalStats;
+  Search::NodeStats nodeStats;
+  ExtMove moveLists[2][MAX_PLY_PLUS_6][MAX_MOVES]; // [singular search][ply]
   Position* activePosition;
   size_t idx;
-  int maxPly;
+  int maxPly, pollCalls, pollInterval;
+  Time::point lastPollTime;
   SplitPoint* volatile activeSplitPoint;
   volatile int splitPointsSize;
   volatile bool searching;
@@ -137,13 +145,13 @@ struct Thread : public ThreadBase {
 /// special threads: the main one and the recurring timer.
 
 struct MainThread : public Thread {
-  MainThread() : thinking(true) {} // Avoid a race with start_thinking()
+  MainThread(Engine* e) : Thread(e), thinking(true) {} // Avoid a race with start_thinking()
   virtual void idle_loop();
   volatile bool thinking;
 };
 
 struct TimerThread : public ThreadBase {
-  TimerThread() : run(false) {}
+  TimerThread(Engine* e) : ThreadBase(e), run(false) {}
   virtual void idle_loop();
   bool run;
   static const int Resolution = 5; // msec between two check_time() calls
@@ -152,25 +160,30 @@ struct TimerThread : public ThreadBase {
 
 /// ThreadPool struct handles all the threads related stuff like init, starting,
 /// parking and, most importantly, launching a slave thread at a split point.
-/// All the access to shared thread data is done through this class.
+/// All the access to shared thread data is done through this class. Each
+/// Engine has its own pool.
 
 struct ThreadPool : public std::vector<Thread*> {
 
-  void init(); // No c'tor and d'tor, threads rely on globals that should
-  void exit(); // be initialized and are valid during the whole thread lifetime.
+  // No c'tor and d'tor, threads rely on the engine that should be valid during
+  // the whole thread lifetime.
+  void init(Engine* e, size_t requested);
+  void exit();
 
   MainThread* main() { return static_cast<MainThread*>((*this)[0]); }
   void read_uci_options();
+  void set_size(size_t requested);
+  void set_eval_hash(size_t mbSize);
   Thread* available_slave(const Thread* master) const;
   void wait_for_think_finished();
   void start_thinking(const Position&, const Search::LimitsType&, Search::StateStackPtr&);
 
+  Engine* engine;
   Depth minimumSplitDepth;
+  size_t evalHashMb;
   Mutex mutex;
   ConditionVariable sleepCondition;
   TimerThread* timer;
 };
 
-extern ThreadPool Threads;
-
 #endif // #ifndef THREAD_H_INCLUDED
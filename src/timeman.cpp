@@ -37,6 +37,8 @@ namespace {
   const double xshift     = 59.8;
   const double skewfactor = 0.172;
 
+  const int ImportancePlies = 1024;
+
 
   // move_importance() is a skew-logistic function based on naive statistical
   // analysis of "how many games are still undecided after n half-moves". Game
@@ -48,17 +50,58 @@ namespace {
     return pow((1 + exp((ply - xshift) / xscale)), -skewfactor) + DBL_MIN; // Ensure non-zero
   }
 
+
+  // ImportanceTable caches move_importance() and its running sums over plies of
+  // the same parity, so that TimeManager::init() does not need to call pow() and
+  // exp() thousands of times per move. This makes a difference when the time
+  // manager is replayed offline for millions of moves.
+
+  struct ImportanceTable {
+
+    ImportanceTable() {
+
+      for (int ply = 0; ply < ImportancePlies; ++ply)
+      {
+          importance[ply] = move_importance(ply);
+          sum[ply] = importance[ply] + (ply >= 2 ? sum[ply - 2] : 0);
+      }
+    }
+
+    double importance[ImportancePlies];
+    double sum[ImportancePlies]; // Sum of importance[] of plies ply, ply-2, ply-4...
+  } Importance;
+
+
+  // other_moves_importance() returns the sum of the importance of our next
+  // 'movesToGo' - 1 moves after the current one.
+
+  double other_moves_importance(int currentPly, int movesToGo) {
+
+    if (movesToGo <= 1)
+        return 0;
+
+    int lastPly = currentPly + 2 * (movesToGo - 1);
+
+    if (lastPly < ImportancePlies)
+        return Importance.sum[lastPly] - Importance.sum[currentPly];
+
+    double s = 0;
+
+    for (int i = 1; i < movesToGo; ++i)
+        s += move_importance(currentPly + 2 * i);
+
+    return s;
+  }
+
   template<TimeType T>
   int remaining(int myTime, int movesToGo, int currentPly, int slowMover)
   {
     const double TMaxRatio   = (T == OptimumTime ? 1 : MaxRatio);
     const double TStealRatio = (T == OptimumTime ? 0 : StealRatio);
 
-    double thisMoveImportance = (move_importance(currentPly) * slowMover) / 100;
-    double otherMovesImportance = 0;
-
-    for (int i = 1; i < movesToGo; ++i)
-        otherMovesImportance += move_importance(currentPly + 2 * i);
+    double thisMoveImportance = (currentPly < ImportancePlies ? Importance.importance[currentPly]
+                                                              : move_importance(currentPly)) * slowMover / 100;
+    double otherMovesImportance = other_moves_importance(currentPly, movesToGo);
 
     double ratio1 = (TMaxRatio * thisMoveImportance) / (TMaxRatio * thisMoveImportance + otherMovesImportance);
     double ratio2 = (thisMoveImportance + TStealRatio * otherMovesImportance) / (thisMoveImportance + otherMovesImportance);
@@ -69,7 +112,24 @@ namespace {
 } // namespace
 
 
-void TimeManager::init(const Search::LimitsType& limits, int currentPly, Color us)
+/// TimeOptions c'tor reads the time management parameters from the UCI options
+
+TimeOptions::TimeOptions() {
+
+  moveOverhead    = Options["Move Overhead"];
+  minThinkingTime = Options["Minimum Thinking Time"];
+  slowMover       = Options["Slow Mover"];
+  ponder          = Options["Ponder"];
+}
+
+
+void TimeManager::init(const Search::LimitsType& limits, int currentPly, Color us) {
+
+  init(limits, currentPly, us, TimeOptions());
+}
+
+
+void TimeManager::init(const Search::LimitsType& limits, int currentPly, Color us, const TimeOptions& o)
 {
   /* We support four different kinds of time controls:
 
@@ -88,13 +148,12 @@ void TimeManager::init(const Search::LimitsType& limits, int currentPly, Color u
 
   int hypMTG, hypMyTime, t1, t2;
 
-  // Read uci parameters
-  int moveOverhead    = Options["Move Overhead"];
-  int minThinkingTime = Options["Minimum Thinking Time"];
-  int slowMover       = Options["Slow Mover"];
+  int moveOverhead    = o.moveOverhead;
+  int minThinkingTime = o.minThinkingTime;
+  int slowMover       = o.slowMover;
 
   // Initialize unstablePvFactor to 1 and search times to maximum values
-  unstablePvFactor = 1;
+  unstablePvFactor = effortFactor = 1;
   optimumSearchTime = maximumSearchTime = std::max(limits.time[us], minThinkingTime);
 
   // We calculate optimum time usage for different hypothetical "moves to go"-values and choose the
@@ -115,9 +174,21 @@ void TimeManager::init(const Search::LimitsType& limits, int currentPly, Color u
       maximumSearchTime = std::min(maximumSearchTime, t2);
   }
 
-  if (Options["Ponder"])
+  if (o.ponder)
       optimumSearchTime += optimumSearchTime / 4;
 
   // Make sure that maxSearchTime is not over absoluteMaxSearchTime
   optimumSearchTime = std::min(optimumSearchTime, maximumSearchTime);
 }
+
+
+/// TimeManager::best_move_effort() scales the available time according to the
+/// fraction of the searched nodes spent on the best move. When the best move
+/// takes almost all the effort, as with an obvious recapture, we can stop
+/// early, while when the effort is spread over many moves the position is
+/// critical and we take some more time.
+
+void TimeManager::best_move_effort(double effort) {
+
+  effortFactor = std::max(0.6, std::min(1.2, 1.0 + 1.6 * (0.75 - effort)));
+}
@@ -20,20 +20,34 @@
 #ifndef TIMEMAN_H_INCLUDED
 #define TIMEMAN_H_INCLUDED
 
+/// TimeOptions stores the UCI parameters used to compute the thinking time. By
+/// default they are read from Options, but they can also be set directly, as
+/// done by the offline time management simulator.
+
+struct TimeOptions {
+  TimeOptions();
+  int moveOverhead, minThinkingTime, slowMover;
+  bool ponder;
+};
+
+
 /// The TimeManager class computes the optimal time to think depending on the
 /// maximum available time, the game move number and other parameters.
 
 class TimeManager {
 public:
   void init(const Search::LimitsType& limits, int currentPly, Color us);
+  void init(const Search::LimitsType& limits, int currentPly, Color us, const TimeOptions& o);
   void pv_instability(double bestMoveChanges) { unstablePvFactor = 1 + bestMoveChanges; }
-  int available_time() const { return int(optimumSearchTime * unstablePvFactor * 0.71); }
+  void best_move_effort(double effort);
+  int available_time() const { return int(optimumSearchTime * unstablePvFactor * effortFactor * 0.71); }
   int maximum_time() const { return maximumSearchTime; }
 
 private:
   int optimumSearchTime;
   int maximumSearchTime;
   double unstablePvFactor;
+  double effortFactor;
 };
 
 #endif // #ifndef TIMEMAN_H_INCLUDED
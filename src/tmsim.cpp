@@ -0,0 +1,291 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2014 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "misc.h"
+#include "search.h"
+#include "thread.h"
+#include "timeman.h"
+
+using namespace std;
+
+namespace {
+
+  // A search iteration as recorded in the time trace: time elapsed since the
+  // start of the search at the end of the iteration, number of best move changes
+  // during the iteration, whether the search has already failed low at root and
+  // the per mille of the root nodes spent on the best move (-1 if unknown).
+  struct Iteration {
+    int elapsed, bestMoveChanges;
+    bool failedLow;
+    int effort;
+  };
+
+  // A move as recorded in the time trace: game ply, clock state of the side to
+  // move, time actually spent on the move and the search iterations.
+  struct MoveRecord {
+    int ply, time, inc, movesToGo, spent;
+    size_t firstIteration, lastIteration;
+  };
+
+  struct Trace {
+    vector<MoveRecord> moves;
+    vector<Iteration> iterations;
+  };
+
+  struct Report {
+    Report() : games(0), moves(0), losses(0), truncated(0),
+               optimumTime(0), maximumTime(0), recordedTime(0), predictedTime(0) {}
+
+    int games, moves, losses, truncated;
+    int64_t optimumTime, maximumTime, recordedTime, predictedTime;
+  };
+
+
+  // read_trace() parses a time trace file. Each line describes a move in the
+  // format written by the search when "Write Time Trace" is set:
+  //
+  //   <ply> <time> <inc> <movestogo> <spent> <elapsed>:<changes>:<failedLow>:<effort> ...
+  //
+  // Times are in milliseconds. A new game starts whenever ply does not increase
+  // with respect to the previous line. Empty lines and lines starting with '#'
+  // are skipped.
+
+  bool read_trace(const string& fileName, Trace& trace) {
+
+    ifstream file(fileName.c_str());
+    string line, token;
+    char sep;
+
+    if (!file.is_open())
+        return false;
+
+    while (getline(file, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        istringstream is(line);
+        MoveRecord r;
+        Iteration it;
+
+        if (!(is >> r.ply >> r.time >> r.inc >> r.movesToGo >> r.spent))
+            continue;
+
+        r.firstIteration = trace.iterations.size();
+
+        while (is >> token)
+        {
+            istringstream ts(token);
+
+            if (ts >> it.elapsed >> sep >> it.bestMoveChanges >> sep >> it.failedLow)
+            {
+                if (!(ts >> sep >> it.effort))
+                    it.effort = -1;
+
+                trace.iterations.push_back(it);
+            }
+        }
+
+        r.lastIteration = trace.iterations.size();
+        trace.moves.push_back(r);
+    }
+
+    return true;
+  }
+
+
+  // predicted_time() replays the recorded iterations of a move through the time
+  // manager and returns the time the search would have spent with the current
+  // policy, mimicking id_loop() and check_time(). A search still in its first
+  // root move is assumed to be in it for the whole iteration. If the recorded
+  // search stopped earlier than the simulated one, the prediction is truncated
+  // to the last recorded iteration.
+
+  int predicted_time(TimeManager& tm, const Trace& trace, const MoveRecord& r, bool& truncated) {
+
+    double bestMoveChanges = 0;
+    bool failedLow = false;
+    int lastElapsed = 0;
+    int maximumTime = tm.maximum_time() - 2 * TimerThread::Resolution;
+
+    truncated = false;
+
+    for (size_t i = r.firstIteration; i < r.lastIteration; ++i)
+    {
+        const Iteration& it = trace.iterations[i];
+        int depth = int(i - r.firstIteration) + 1;
+        int firstMoveTime = tm.available_time() * 75 / 100;
+
+        failedLow = failedLow || it.failedLow;
+
+        if (it.elapsed > maximumTime)
+            return std::max(lastElapsed, maximumTime);
+
+        if (!failedLow && it.elapsed > firstMoveTime)
+            return std::max(lastElapsed, firstMoveTime);
+
+        bestMoveChanges = bestMoveChanges * 0.5 + it.bestMoveChanges;
+
+        if (depth > 4)
+        {
+            tm.pv_instability(bestMoveChanges);
+
+            if (it.effort >= 0)
+                tm.best_move_effort(it.effort / 1000.0);
+        }
+
+        if (it.elapsed > tm.available_time())
+            return it.elapsed;
+
+        lastElapsed = it.elapsed;
+    }
+
+    truncated = true;
+    return lastElapsed;
+  }
+
+
+  // simulate() plays back all the games of the trace with the given time
+  // options. Clocks start from the recorded ones and are then credited or
+  // debited of the difference between recorded and predicted spent time.
+
+  Report simulate(const Trace& trace, const TimeOptions& o) {
+
+    Report rep;
+    Search::LimitsType limits;
+    TimeManager tm;
+    int saved[COLOR_NB] = { 0, 0 };
+    int lastPly = -1;
+    bool lost = false;
+    bool truncated;
+
+    for (size_t i = 0; i < trace.moves.size(); ++i)
+    {
+        const MoveRecord& r = trace.moves[i];
+        Color us = (r.ply & 1) ? BLACK : WHITE;
+
+        if (r.ply <= lastPly || lastPly < 0)
+        {
+            saved[WHITE] = saved[BLACK] = 0;
+            lost = false;
+            ++rep.games;
+        }
+
+        lastPly = r.ply;
+
+        if (lost)
+            continue;
+
+        limits.time[us] = r.time + saved[us];
+        limits.inc[us] = r.inc;
+        limits.movestogo = r.movesToGo;
+
+        tm.init(limits, r.ply, us, o);
+
+        rep.optimumTime += tm.available_time();
+        rep.maximumTime += tm.maximum_time();
+
+        int predicted = predicted_time(tm, trace, r, truncated);
+
+        rep.truncated += truncated;
+        rep.recordedTime += r.spent;
+        rep.predictedTime += predicted;
+        ++rep.moves;
+
+        if (predicted > limits.time[us])
+        {
+            ++rep.losses;
+            lost = true;
+        }
+
+        saved[us] += r.spent - predicted;
+    }
+
+    return rep;
+  }
+
+} // namespace
+
+
+/// tmsim() is an offline simulator of the time manager. It replays the clock
+/// states and search iterations recorded in a time trace file through
+/// TimeManager and reports allocated and predicted spent time and losses on
+/// time. The parameters are the trace file name, the minimum thinking time,
+/// the move overhead and one or more slow mover values to compare: missing
+/// values default to the current UCI options.
+
+void tmsim(istream& is) {
+
+  string fileName, token;
+  TimeOptions o;
+  vector<int> slowMovers;
+  Trace trace;
+
+  is >> fileName;
+
+  if (is >> token) o.minThinkingTime = atoi(token.c_str());
+  if (is >> token) o.moveOverhead = atoi(token.c_str());
+
+  while (is >> token)
+      slowMovers.push_back(atoi(token.c_str()));
+
+  if (slowMovers.empty())
+      slowMovers.push_back(o.slowMover);
+
+  if (!read_trace(fileName, trace))
+  {
+      cerr << "Unable to open file " << fileName << endl;
+      return;
+  }
+
+  int64_t decisions = 0;
+  Time::point elapsed = Time::now();
+
+  for (size_t i = 0; i < slowMovers.size(); ++i)
+  {
+      o.slowMover = slowMovers[i];
+      Report rep = simulate(trace, o);
+      decisions += rep.moves;
+      int moves = std::max(rep.moves, 1);
+
+      sync_cout << "slowmover "   << o.slowMover
+                << " games "      << rep.games
+                << " moves "      << rep.moves
+                << " losses "     << rep.losses
+                << " optimum "    << rep.optimumTime / moves
+                << " maximum "    << rep.maximumTime / moves
+                << " recorded "   << rep.recordedTime / moves
+                << " predicted "  << rep.predictedTime / moves
+                << " truncated "  << rep.truncated << sync_endl;
+  }
+
+  elapsed = std::max(Time::now() - elapsed, Time::point(1));
+
+  cerr << "\n==========================="
+       << "\nTotal time (ms) : " << elapsed
+       << "\nDecisions       : " << decisions
+       << "\nDecisions/second: " << 1000 * decisions / elapsed << endl;
+}
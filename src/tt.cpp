@@ -23,8 +23,6 @@
 #include "bitboard.h"
 #include "tt.h"
 
-TranspositionTable TT; // Our global transposition table
-
 
 /// TranspositionTable::resize() sets the size of the transposition table,
 /// measured in megabytes. Transposition table consists of a power of 2 number
@@ -38,6 +36,7 @@ void TranspositionTable::resize(size_t mbSize) {
       return;
 
   clusterCount = newClusterCount;
+  generation = &ownGeneration;
 
   free(mem);
   mem = calloc(clusterCount * sizeof(TTCluster) + CACHE_LINE_SIZE - 1, 1);
@@ -53,6 +52,24 @@ void TranspositionTable::resize(size_t mbSize) {
 }
 
 
+/// TranspositionTable::share() makes the table use the clusters of another
+/// one, so that many engines can search with a common hash. The other table
+/// owns the memory and must not be resized or freed while it is shared. Calling
+/// resize() with a different size gives back a table of its own. The entries
+/// are aged with the generation of the owner too: new_search() of a shared
+/// table does nothing, else each engine would see the entries of the others as
+/// stale, and it is up to the owner to call its new_search().
+
+void TranspositionTable::share(TranspositionTable& tt) {
+
+  free(mem);
+  mem = NULL;
+  clusterCount = tt.clusterCount;
+  table = tt.table;
+  generation = &tt.ownGeneration;
+}
+
+
 /// TranspositionTable::clear() overwrites the entire transposition table
 /// with zeroes. It is called whenever the table is resized, or when the
 /// user asks the program to clear the table (from the UCI interface).
@@ -75,7 +92,7 @@ const TTEntry* TranspositionTable::probe(const Key key) const {
   for (unsigned i = 0; i < TTClusterSize; ++i, ++tte)
       if (tte->key16 == key16)
       {
-          tte->genBound8 = generation | tte->bound(); // Refresh
+          tte->genBound8 = *generation | tte->bound(); // Refresh
           return tte;
       }
 
@@ -95,6 +112,7 @@ void TranspositionTable::store(const Key key, Value v, Bound b, Depth d, Move m,
 
   TTEntry *tte, *replace;
   uint16_t key16 = key >> 48; // Use the high 16 bits as key inside the cluster
+  uint8_t gen = *generation;
 
   tte = replace = first_entry(key);
 
@@ -110,11 +128,11 @@ void TranspositionTable::store(const Key key, Value v, Bound b, Depth d, Move m,
       }
 
       // Implement replace strategy
-      if (  ((    tte->genBound8 & 0xFC) == generation || tte->bound() == BOUND_EXACT)
-          - ((replace->genBound8 & 0xFC) == generation)
+      if (  ((    tte->genBound8 & 0xFC) == gen || tte->bound() == BOUND_EXACT)
+          - ((replace->genBound8 & 0xFC) == gen)
           - (tte->depth8 < replace->depth8) < 0)
           replace = tte;
   }
 
-  replace->save(key16, v, b, d, m, generation, statV);
+  replace->save(key16, v, b, d, m, gen, statV);
 }
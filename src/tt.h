@@ -84,12 +84,14 @@ struct TTCluster {
 class TranspositionTable {
 
 public:
+  TranspositionTable() : clusterCount(0), table(NULL), mem(NULL), generation(&ownGeneration), ownGeneration(0) {}
  ~TranspositionTable() { free(mem); }
-  void new_search() { generation += 4; } // Lower 2 bits are used by Bound
+  void new_search() { if (generation == &ownGeneration) ownGeneration += 4; } // Lower 2 bits are used by Bound
 
   const TTEntry* probe(const Key key) const;
   TTEntry* first_entry(const Key key) const;
   void resize(size_t mbSize);
+  void share(TranspositionTable& tt);
   void clear();
   void store(const Key key, Value v, Bound type, Depth d, Move m, Value statV);
 
@@ -97,11 +99,10 @@ private:
   size_t clusterCount;
   TTCluster* table;
   void* mem;
-  uint8_t generation; // Size must be not bigger than TTEntry::genBound8
+  uint8_t* generation; // Of the owner of the clusters, see share()
+  uint8_t ownGeneration; // Size must be not bigger than TTEntry::genBound8
 };
 
-extern TranspositionTable TT;
-
 
 /// TranspositionTable::first_entry() returns a pointer to the first entry of
 /// a cluster given a position. The lowest order bits of the key are used to
@@ -54,10 +54,15 @@
 #  include <nmmintrin.h> // Intel header for _mm_popcnt_u64() intrinsic
 #endif
 
-#if defined(USE_PEXT)
-#  include <immintrin.h> // Header for _pext_u64() intrinsic
-#else
+#if defined(USE_PEXT) || defined(USE_AVX2)
+#  include <immintrin.h> // Header for _pext_u64() and AVX2 intrinsics
+#endif
+
+#if defined(USE_DISPATCH)
+#  define _pext_u64(b, m) pext_asm(b, m)
+#elif !defined(USE_PEXT)
 #  define _pext_u64(b, m) (0)
+#  define _pdep_u64(b, m) (0)
 #endif
 
 #  if !defined(NO_PREFETCH) && (defined(__INTEL_COMPILER) || defined(_MSC_VER))
@@ -79,6 +84,20 @@
 #  define FORCE_INLINE  inline
 #endif
 
+/// With runtime dispatch the CPU features are detected at startup, see
+/// bitboard.cpp, and the instructions are emitted with inline assembly so
+/// that the compiler does not need to target them.
+
+#if defined(USE_DISPATCH)
+extern bool HasPopCnt;
+extern bool HasPext;
+
+inline uint64_t pext_asm(uint64_t b, uint64_t m) {
+  __asm__("pextq %2, %1, %0" : "=r"(b) : "r"(b), "rm"(m));
+  return b;
+}
+#else
+
 #ifdef USE_POPCNT
 const bool HasPopCnt = true;
 #else
@@ -91,6 +110,20 @@ const bool HasPext = true;
 const bool HasPext = false;
 #endif
 
+#endif
+
+#ifdef USE_DISPATCH
+const bool HasDispatch = true;
+#else
+const bool HasDispatch = false;
+#endif
+
+#ifdef USE_AVX2
+const bool HasAvx2 = true;
+#else
+const bool HasAvx2 = false;
+#endif
+
 #ifdef IS_64BIT
 const bool Is64Bit = true;
 #else
@@ -22,17 +22,23 @@
 #include <sstream>
 #include <string>
 
+#include "engine.h"
 #include "evaluate.h"
 #include "notation.h"
 #include "position.h"
 #include "search.h"
-#include "thread.h"
-#include "tt.h"
 #include "ucioption.h"
 
 using namespace std;
 
 extern void benchmark(const Position& pos, istream& is);
+extern void analyse(istream& is);
+extern void eval_batch(istream& is);
+extern void convert(istream& is);
+extern void match(istream& is);
+extern void gensfen(istream& is);
+extern void serve(istream& is);
+extern void tmsim(istream& is);
 
 namespace {
 
@@ -68,7 +74,7 @@ namespace {
     else
         return;
 
-    pos.set(fen, Options["UCI_Chess960"], Threads.main());
+    pos.set(fen, Options["UCI_Chess960"], UCIEngine.threads.main());
     SetupStates = Search::StateStackPtr(new std::stack<StateInfo>());
 
     // Parse move list (if any)
@@ -132,7 +138,7 @@ namespace {
         else if (token == "ponder")    limits.ponder = true;
     }
 
-    Threads.start_thinking(pos, limits, SetupStates);
+    UCIEngine.threads.start_thinking(pos, limits, SetupStates);
   }
 
 } // namespace
@@ -145,7 +151,7 @@ namespace {
 
 void UCI::loop(int argc, char* argv[]) {
 
-  Position pos(StartFEN, false, Threads.main()); // The root position
+  Position pos(StartFEN, false, UCIEngine.threads.main()); // The root position
   string token, cmd;
 
   for (int i = 1; i < argc; ++i)
@@ -162,17 +168,17 @@ void UCI::loop(int argc, char* argv[]) {
       if (token == "quit" || token == "stop" || token == "ponderhit")
       {
           // The GUI sends 'ponderhit' to tell us to ponder on the same move the
-          // opponent has played. In case Signals.stopOnPonderhit is set we are
+          // opponent has played. In case signals.stopOnPonderhit is set we are
           // waiting for 'ponderhit' to stop the search (for instance because we
           // already ran out of time), otherwise we should continue searching but
           // switch from pondering to normal search.
-          if (token != "ponderhit" || Search::Signals.stopOnPonderhit)
+          if (token != "ponderhit" || UCIEngine.signals.stopOnPonderhit)
           {
-              Search::Signals.stop = true;
-              Threads.main()->notify_one(); // Could be sleeping
+              UCIEngine.signals.stop = true;
+              UCIEngine.threads.main()->notify_one(); // Could be sleeping
           }
           else
-              Search::Limits.ponder = false;
+              UCIEngine.limits.ponder = false;
       }
       else if (token == "perft")
       {
@@ -197,12 +203,19 @@ void UCI::loop(int argc, char* argv[]) {
                     << "\n"       << Options
                     << "\nuciok"  << sync_endl;
 
-      else if (token == "ucinewgame") TT.clear();
+      else if (token == "ucinewgame") UCIEngine.tt.clear();
       else if (token == "go")         go(pos, is);
       else if (token == "position")   position(pos, is);
       else if (token == "setoption")  setoption(is);
       else if (token == "flip")       pos.flip();
       else if (token == "bench")      benchmark(pos, is);
+      else if (token == "analyse")    analyse(is);
+      else if (token == "evalbatch")  eval_batch(is);
+      else if (token == "convert")    convert(is);
+      else if (token == "match")      match(is);
+      else if (token == "gensfen")    gensfen(is);
+      else if (token == "serve")      serve(is);
+      else if (token == "tmsim")      tmsim(is);
       else if (token == "d")          sync_cout << pos.pretty() << sync_endl;
       else if (token == "isready")    sync_cout << "readyok" << sync_endl;
       else if (token == "eval")       sync_cout << Eval::trace(pos) << sync_endl;
@@ -211,5 +224,5 @@ void UCI::loop(int argc, char* argv[]) {
 
   } while (token != "quit" && argc == 1); // Passed args have one-shot behaviour
 
-  Threads.wait_for_think_finished(); // Cannot quit whilst the search is running
+  UCIEngine.threads.wait_for_think_finished(); // Cannot quit whilst the search is running
 }
@@ -22,10 +22,9 @@
 #include <cstdlib>
 #include <sstream>
 
+#include "engine.h"
 #include "evaluate.h"
 #include "misc.h"
-#include "thread.h"
-#include "tt.h"
 #include "ucioption.h"
 
 using std::string;
@@ -37,9 +36,10 @@ namespace UCI {
 /// 'On change' actions, triggered by an option's value change
 void on_logger(const Option& o) { start_logger(o); }
 void on_eval(const Option&) { Eval::init(); }
-void on_threads(const Option&) { Threads.read_uci_options(); }
-void on_hash_size(const Option& o) { TT.resize(o); }
-void on_clear_hash(const Option&) { TT.clear(); }
+void on_threads(const Option&) { UCIEngine.threads.read_uci_options(); }
+void on_hash_size(const Option& o) { UCIEngine.tt.resize(o); }
+void on_eval_hash(const Option& o) { UCIEngine.threads.set_eval_hash(o); }
+void on_clear_hash(const Option&) { UCIEngine.tt.clear(); }
 
 
 /// Our case insensitive less() function as required by UCI protocol
@@ -59,13 +59,17 @@ void init(OptionsMap& o) {
   o["Min Split Depth"]       << Option(0, 0, 12, on_threads);
   o["Threads"]               << Option(1, 1, MAX_THREADS, on_threads);
   o["Hash"]                  << Option(16, 1, 1024 * 1024, on_hash_size);
+  o["Eval Hash"]             << Option(0, 0, 1024, on_eval_hash);
   o["Clear Hash"]            << Option(on_clear_hash);
   o["Ponder"]                << Option(true);
   o["MultiPV"]               << Option(1, 1, 500);
+  o["MultiPV Shared Window"] << Option(false);
   o["Skill Level"]           << Option(20, 0, 20);
   o["Move Overhead"]         << Option(30, 0, 5000);
   o["Minimum Thinking Time"] << Option(20, 0, 5000);
   o["Slow Mover"]            << Option(80, 10, 1000);
+  o["Timer Thread"]          << Option(true);
+  o["Write Time Trace"]      << Option(false);
   o["UCI_Chess960"]          << Option(false);
 }
 
@@ -96,16 +100,16 @@ std::ostream& operator<<(std::ostream& os, const OptionsMap& om) {
 
 /// Option class constructors and conversion operators
 
-Option::Option(const char* v, OnChange f) : type("string"), min(0), max(0), on_change(f)
+Option::Option(const char* v, OnChange f) : type("string"), min(0), max(0), idx(0), on_change(f)
 { defaultValue = currentValue = v; }
 
-Option::Option(bool v, OnChange f) : type("check"), min(0), max(0), on_change(f)
+Option::Option(bool v, OnChange f) : type("check"), min(0), max(0), idx(0), on_change(f)
 { defaultValue = currentValue = (v ? "true" : "false"); }
 
-Option::Option(OnChange f) : type("button"), min(0), max(0), on_change(f)
+Option::Option(OnChange f) : type("button"), min(0), max(0), idx(0), on_change(f)
 {}
 
-Option::Option(int v, int minv, int maxv, OnChange f) : type("spin"), min(minv), max(maxv), on_change(f)
+Option::Option(int v, int minv, int maxv, OnChange f) : type("spin"), min(minv), max(maxv), idx(0), on_change(f)
 { std::ostringstream ss; ss << v; defaultValue = currentValue = ss.str(); }
 
 